@@ -0,0 +1,1073 @@
+/*
+The benchmark suite of the C++ Extended String Class.
+
+each operation is measured on small (16 bytes), medium (4 KiB) and huge (16 MiB) inputs, made of either ASCII text or text mixing ASCII with multibyte UTF-8 sequences, along with a baseline written directly against (std::string) where there is a direct equivalent. Build the (str_bench_json) target to write the results as JSON for comparing runs.
+*/
+
+#include "str.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace
+{
+	// The input sizes (in bytes) of the benchmarks of single strings, and the numbers of strings of the benchmarks of collections.
+	constexpr int64_t small_size = 16, medium_size = 4 << 10, huge_size = 16 << 20;
+	constexpr int64_t few_strs = 1 << 10, some_strs = 1 << 14, many_strs = 1 << 20;
+
+	// returns pseudo-random text of a given size (in bytes): words of letters (mixed with multibyte UTF-8 sequences if requested) separated by spaces and occasional punctuation. The text is the same on every run.
+	std::string make_text(const size_t size, const bool non_ascii, const unsigned seed = 42)
+	{
+		static const char* const multibyte[] = { "\xC3\xA9", "\xC3\xB6", "\xC3\x9F", "\xD0\x96", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80" };
+
+		std::mt19937 rng(seed);
+		std::string text = {};
+		text.reserve(size + 4);
+
+		while (text.length() < size)
+		{
+			const unsigned r = rng() % 64;
+
+			if (r < 8)
+				text += ' ';
+			else if (r == 8)
+				text += ", ";
+			else if (non_ascii && r < 16)
+				text += multibyte[r % 6];
+			else
+				text += static_cast<char>(((r & 1) ? 'A' : 'a') + rng() % 26);
+		}
+
+		// keep the text valid UTF-8 when cutting it to size.
+		while (text.length() > size)
+			text.pop_back();
+		while (!text.empty() && !str::is_valid_utf8(text))
+			text.pop_back();
+
+		return text;
+	}
+
+	// returns a given number of short pseudo-random strings.
+	std::vector<std::string> make_strs(const size_t n, const bool non_ascii)
+	{
+		const std::string text = make_text(n * 12, non_ascii);
+		std::vector<std::string> strs = str::split(text, " ");
+
+		strs.resize(n, "x");
+
+		return strs;
+	}
+
+	// returns pseudo-random CSV text of a given size (in bytes): the text of (make_text) with some of its spaces turned into commas and line feeds. The text is the same on every run.
+	std::string make_csv(const size_t size, const bool non_ascii)
+	{
+		std::mt19937 rng(7);
+		std::string text = make_text(size, non_ascii);
+
+		for (char& c : text)
+			if (c == ' ')
+			{
+				const unsigned r = rng() % 16;
+
+				c = (r == 0) ? '\n' : (r < 6) ? ',' : ' ';
+			}
+
+		return text;
+	}
+
+	// sets the number of bytes processed by a benchmark of a given input size.
+	void set_bytes(benchmark::State& state, const size_t size)
+	{
+		state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+	}
+
+	// registers the sizes and data kinds of a benchmark of single strings.
+	void text_args(benchmark::internal::Benchmark* bench)
+	{
+		bench->ArgsProduct({ { small_size, medium_size, huge_size }, { 0, 1 } })->ArgNames({ "size", "non_ascii" });
+	}
+	// registers the sizes and data kinds of a benchmark of collections of strings.
+	void strs_args(benchmark::internal::Benchmark* bench)
+	{
+		bench->ArgsProduct({ { few_strs, some_strs, many_strs }, { 0, 1 } })->ArgNames({ "strs", "non_ascii" });
+	}
+}
+
+// find family
+
+static void BM_find(benchmark::State& state)
+{
+	const str text = make_text(state.range(0), state.range(1));
+	const std::string needle = "zZz!";
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(text.find(needle));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_find)->Apply(text_args);
+
+static void BM_find_case_insensitive(benchmark::State& state)
+{
+	const str text = make_text(state.range(0), state.range(1));
+	const std::string needle = "zZz!";
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(text.find(needle, false));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_find_case_insensitive)->Apply(text_args);
+
+static void BM_std_find(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+	const std::string needle = "zZz!";
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(text.find(needle));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_find)->Apply(text_args);
+
+static void BM_parallel_find_all(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::parallel_find_all(text, "ab"));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_parallel_find_all)->Apply(text_args);
+
+static void BM_parallel_count(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::parallel_count(text, "ab"));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_parallel_count)->Apply(text_args);
+
+static void BM_count(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::count(text, 'a', false));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_count)->Apply(text_args);
+
+static void BM_word_count(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::word_count(text, whitespaces));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_word_count)->Apply(text_args);
+
+static void BM_parallel_word_count(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::parallel_word_count(text, whitespaces));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_parallel_word_count)->Apply(text_args);
+
+// split and join
+
+static void BM_split(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::split(text, " "));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_split)->Apply(text_args);
+
+static void BM_std_split(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		std::vector<std::string> substrs = {};
+
+		for (size_t start_pos = 0, delim_pos = 0; start_pos < text.length(); start_pos = delim_pos + 1)
+		{
+			delim_pos = std::min(text.find(' ', start_pos), text.length());
+
+			if (delim_pos != start_pos)
+				substrs.emplace_back(text, start_pos, delim_pos - start_pos);
+		}
+
+		benchmark::DoNotOptimize(substrs);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_split)->Apply(text_args);
+
+static void BM_parse_csv(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::parse_csv(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_parse_csv)->Apply(text_args);
+
+static void BM_split_csv(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		std::vector<std::vector<std::string>> records = {};
+
+		for (const std::string& line : str::split(text, "\n"))
+			records.push_back(str::split(line, ","));
+
+		benchmark::DoNotOptimize(records);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_split_csv)->Apply(text_args);
+
+static void BM_parse_kv(benchmark::State& state)
+{
+	const std::string text = str::join(make_strs(state.range(0), state.range(1)), "=v&");
+
+	for (auto _ : state)
+	{
+		size_t n = 0;
+
+		for (const str::kv_pair& pair : str::parse_kv(text))
+			n += pair.value.length();
+
+		benchmark::DoNotOptimize(n);
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_parse_kv)->Apply(strs_args);
+
+static void BM_split_kv(benchmark::State& state)
+{
+	const std::string text = str::join(make_strs(state.range(0), state.range(1)), "=v&");
+
+	for (auto _ : state)
+	{
+		std::vector<std::vector<std::string>> pairs = {};
+
+		for (const std::string& pair : str::split(text, "&"))
+			pairs.push_back(str::split(pair, "="));
+
+		benchmark::DoNotOptimize(pairs);
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_split_kv)->Apply(strs_args);
+
+static void BM_join(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::join(strs, ", "));
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_join)->Apply(strs_args);
+
+static void BM_std_join(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		std::string joined = {};
+
+		for (size_t i = 0; i < strs.size(); ++i)
+		{
+			if (i != 0)
+				joined += ", ";
+
+			joined += strs[i];
+		}
+
+		benchmark::DoNotOptimize(joined);
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_std_join)->Apply(strs_args);
+
+// case conversion
+
+static void BM_to_upper(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::to_upper(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_to_upper)->Apply(text_args);
+
+static void BM_to_upper_utf8(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::to_upper(text, str::utf8));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_to_upper_utf8)->Apply(text_args);
+
+static void BM_capitalize_utf8(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::capitalize(text, " ", str::utf8));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_capitalize_utf8)->Apply(text_args);
+
+static void BM_depunctuate_utf8(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::depunctuate(text, str::utf8));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_depunctuate_utf8)->Apply(text_args);
+
+static void BM_vowel_count_utf8(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::vowel_count(text, false, str::utf8));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_vowel_count_utf8)->Apply(text_args);
+
+static void BM_std_to_upper(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		std::string upper = text;
+
+		std::transform(upper.begin(), upper.end(), upper.begin(), [](const unsigned char c) { return static_cast<char>(std::toupper(c)); });
+
+		benchmark::DoNotOptimize(upper);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_to_upper)->Apply(text_args);
+
+static void BM_swap_case(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::swap_case(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_swap_case)->Apply(text_args);
+
+static void BM_capitalize(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::capitalize(text, whitespaces));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_capitalize)->Apply(text_args);
+
+static void BM_depunctuate(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::depunctuate(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_depunctuate)->Apply(text_args);
+
+static void BM_std_depunctuate(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		std::string depunct_text = text;
+		depunct_text.erase(std::remove_if(depunct_text.begin(), depunct_text.end(), [](const char c) { return std::ispunct(static_cast<unsigned char>(c)) != 0; }), depunct_text.end());
+
+		benchmark::DoNotOptimize(depunct_text);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_depunctuate)->Apply(text_args);
+
+static void BM_erase_if(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+	const str::char_class removed = str::char_class::spaces() | str::char_class::digits();
+
+	for (auto _ : state)
+	{
+		std::string filtered_text = text;
+		str::erase_if(filtered_text, removed);
+
+		benchmark::DoNotOptimize(filtered_text);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_erase_if)->Apply(text_args);
+
+// trimming
+
+static void BM_trim(benchmark::State& state)
+{
+	const std::string text = "   \t" + make_text(state.range(0), state.range(1)) + " \n  ";
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::trim(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_trim)->Apply(text_args);
+
+static void BM_std_trim(benchmark::State& state)
+{
+	const std::string text = "   \t" + make_text(state.range(0), state.range(1)) + " \n  ";
+
+	for (auto _ : state)
+	{
+		const size_t first = text.find_first_not_of(whitespaces), last = text.find_last_not_of(whitespaces);
+
+		benchmark::DoNotOptimize(text.substr(first, last + 1 - first));
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_trim)->Apply(text_args);
+
+static void BM_trim_view(benchmark::State& state)
+{
+	const std::string padding(256, ' ');
+	const std::string text = padding + "\t" + make_text(state.range(0), state.range(1)) + "\r\n" + padding;
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::trim_view(text));
+
+	// only the trimmed whitespaces are scanned.
+	set_bytes(state, text.length() - str::trim_view(text).length());
+}
+BENCHMARK(BM_trim_view)->Apply(text_args);
+
+static void BM_trim_each(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+	const str::csv_table table = str::parse_csv(text);
+	std::vector<std::string_view> fields = {};
+
+	for (size_t i = 0; i < table.size(); ++i)
+		for (const std::string_view field : table[i])
+			fields.push_back(field);
+
+	for (auto _ : state)
+	{
+		std::vector<std::string_view> trimmed = fields;
+		str::trim_each(trimmed);
+		benchmark::DoNotOptimize(trimmed.data());
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_trim_each)->Apply(text_args);
+
+static void BM_normalize_whitespace(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::normalize_whitespace(text, ' ', str::fold_to_lower));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_normalize_whitespace)->Apply(text_args);
+
+static void BM_split_join_normalize(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::to_lower(str::join(str::split<' ', '\t', '\n', '\v', '\f', '\r'>(text))));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_split_join_normalize)->Apply(text_args);
+
+// pipelines
+
+static void BM_pipeline(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(text | str_pipes::split(',') | str_pipes::trim | str_pipes::lower | str_pipes::to_pieces);
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_pipeline)->Apply(text_args);
+
+static void BM_chained_split_trim_lower(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		std::vector<std::string> fields = str::split(text, ",");
+
+		for (std::string& field : fields)
+			field = str::to_lower(std::string(str::trim_view(field)));
+
+		benchmark::DoNotOptimize(fields);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_chained_split_trim_lower)->Apply(text_args);
+
+// repetition
+
+static void BM_repeat(benchmark::State& state)
+{
+	const std::string text = make_text(small_size, state.range(1));
+	const size_t n = state.range(0) / small_size;
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::repeat(text, n, ", "));
+
+	set_bytes(state, text.length() * n);
+}
+BENCHMARK(BM_repeat)->Apply(text_args);
+
+static void BM_std_repeat(benchmark::State& state)
+{
+	const std::string text = make_text(small_size, state.range(1));
+	const size_t n = state.range(0) / small_size;
+
+	for (auto _ : state)
+	{
+		std::string repeated = {};
+		repeated.reserve((text.length() + 2) * n);
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (i != 0)
+				repeated += ", ";
+
+			repeated += text;
+		}
+
+		benchmark::DoNotOptimize(repeated);
+	}
+
+	set_bytes(state, text.length() * n);
+}
+BENCHMARK(BM_std_repeat)->Apply(text_args);
+
+// appending
+
+// appends the words of a text to an extended string one at a time, with the capacity policy given (the default one if range 2 is zero).
+static void BM_append_words(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+	const std::vector<std::string> words = str::split(text, " ");
+
+	if (state.range(2) != 0)
+	{
+		str::capacity_policy policy = {};
+		policy.growth_percent = 50;
+		policy.min_growth = 256;
+		policy.page_size = 4096;
+		policy.page_threshold = 1 << 16;
+
+		str::set_capacity_policy(policy);
+	}
+
+	for (auto _ : state)
+	{
+		str built = {};
+
+		for (const std::string& word : words)
+		{
+			built += word;
+			built += ' ';
+		}
+
+		benchmark::DoNotOptimize(built);
+	}
+
+	str::set_capacity_policy({});
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_append_words)->ArgsProduct({ { medium_size, huge_size }, { 0 }, { 0, 1 } })->ArgNames({ "size", "non_ascii", "policy" });
+
+// comparison
+
+static void BM_compare(benchmark::State& state)
+{
+	const std::string text_l = make_text(state.range(0), state.range(1)), text_r = text_l;
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::compare(text_l, text_r));
+
+	set_bytes(state, text_l.length());
+}
+BENCHMARK(BM_compare)->Apply(text_args);
+
+static void BM_compare_case_insensitive(benchmark::State& state)
+{
+	const std::string text_l = make_text(state.range(0), state.range(1)), text_r = str::to_upper(text_l);
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::compare(text_l, text_r, false));
+
+	set_bytes(state, text_l.length());
+}
+BENCHMARK(BM_compare_case_insensitive)->Apply(text_args);
+
+static void BM_std_compare(benchmark::State& state)
+{
+	const std::string text_l = make_text(state.range(0), state.range(1)), text_r = text_l;
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(text_l.compare(text_r));
+
+	set_bytes(state, text_l.length());
+}
+BENCHMARK(BM_std_compare)->Apply(text_args);
+
+static void BM_natural_compare(benchmark::State& state)
+{
+	const std::string text_l = make_text(state.range(0), state.range(1)) + "file10", text_r = text_l.substr(0, text_l.length() - 2) + "9";
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::natural_compare(text_l, text_r));
+
+	set_bytes(state, text_l.length());
+}
+BENCHMARK(BM_natural_compare)->Apply(text_args);
+
+static void BM_edit_distance(benchmark::State& state)
+{
+	const std::string text_l = make_text(state.range(0), state.range(1), 1), text_r = make_text(state.range(0), state.range(1), 2);
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::edit_distance(text_l, text_r));
+
+	set_bytes(state, text_l.length());
+}
+// the edit distance takes quadratic time, so huge inputs are left out.
+BENCHMARK(BM_edit_distance)->ArgsProduct({ { small_size, 256, medium_size }, { 0, 1 } })->ArgNames({ "size", "non_ascii" });
+
+// replacement
+
+static void BM_find_and_replace(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1)) + " the end";
+
+	for (auto _ : state)
+	{
+		std::string text_ = text;
+
+		benchmark::DoNotOptimize(str::find_and_replace(text_, std::string("the"), std::string("THE")));
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_find_and_replace)->Apply(text_args);
+
+static void BM_std_replace(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1)) + " the end";
+
+	for (auto _ : state)
+	{
+		std::string text_ = text;
+
+		for (size_t pos = text_.find("the"); pos != std::string::npos; pos = text_.find("the", pos + 3))
+			text_.replace(pos, 3, "THE");
+
+		benchmark::DoNotOptimize(text_);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_replace)->Apply(text_args);
+
+static void BM_reverse(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::reverse(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_reverse)->Apply(text_args);
+
+static void BM_std_reverse(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(std::string(text.rbegin(), text.rend()));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_reverse)->Apply(text_args);
+
+static void BM_reverse_words(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::reverse_words(text, " "));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_reverse_words)->Apply(text_args);
+
+// escaping
+
+static void BM_escape_json(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::escape_json(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_escape_json)->Apply(text_args);
+
+static void BM_std_escape_json(benchmark::State& state)
+{
+	const std::string text = make_csv(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		std::string escaped = {};
+
+		for (const char c : text)
+			switch (c)
+			{
+			case '"': escaped += "\\\""; break;
+			case '\\': escaped += "\\\\"; break;
+			case '\n': escaped += "\\n"; break;
+			case '\r': escaped += "\\r"; break;
+			case '\t': escaped += "\\t"; break;
+			default: escaped += c; break;
+			}
+
+		benchmark::DoNotOptimize(escaped);
+	}
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_std_escape_json)->Apply(text_args);
+
+static void BM_escape_html(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::escape_html(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_escape_html)->Apply(text_args);
+
+static void BM_url_encode(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::url_encode(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_url_encode)->Apply(text_args);
+
+static void BM_to_base64(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::to_base64(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_to_base64)->Apply(text_args);
+
+static void BM_from_base64(benchmark::State& state)
+{
+	const std::string encoded = str::to_base64(make_text(state.range(0), state.range(1)));
+	std::string data = {};
+
+	for (auto _ : state)
+	{
+		str::from_base64(encoded, data);
+
+		benchmark::DoNotOptimize(data.data());
+	}
+
+	set_bytes(state, encoded.length());
+}
+BENCHMARK(BM_from_base64)->Apply(text_args);
+
+static void BM_to_hex(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::to_hex(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_to_hex)->Apply(text_args);
+
+static void BM_from_hex(benchmark::State& state)
+{
+	const std::string encoded = str::to_hex(make_text(state.range(0), state.range(1)));
+	std::string data = {};
+
+	for (auto _ : state)
+	{
+		str::from_hex(encoded, data);
+
+		benchmark::DoNotOptimize(data.data());
+	}
+
+	set_bytes(state, encoded.length());
+}
+BENCHMARK(BM_from_hex)->Apply(text_args);
+
+// UTF-8
+
+static void BM_is_valid_utf8(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::is_valid_utf8(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_is_valid_utf8)->Apply(text_args);
+
+static void BM_codepoint_count(benchmark::State& state)
+{
+	const std::string text = make_text(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::codepoint_count(text));
+
+	set_bytes(state, text.length());
+}
+BENCHMARK(BM_codepoint_count)->Apply(text_args);
+
+// collections
+
+static void BM_sort(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<std::string> strs_ = strs;
+		state.ResumeTiming();
+
+		str::sort(strs_);
+
+		benchmark::DoNotOptimize(strs_.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_sort)->Apply(strs_args);
+
+static void BM_std_sort(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<std::string> strs_ = strs;
+		state.ResumeTiming();
+
+		std::sort(strs_.begin(), strs_.end());
+
+		benchmark::DoNotOptimize(strs_.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_std_sort)->Apply(strs_args);
+
+#if defined(STR_EXECUTION)
+static void BM_std_sort_parallel(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<std::string> strs_ = strs;
+		state.ResumeTiming();
+
+		std::sort(std::execution::par, strs_.begin(), strs_.end());
+
+		benchmark::DoNotOptimize(strs_.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_std_sort_parallel)->Apply(strs_args);
+#endif
+
+// sorts strings sharing a long prefix (as URLs or paths of a single site do), by (sort) if range 2 is zero and by std::sort otherwise.
+static void BM_sort_shared_prefix(benchmark::State& state)
+{
+	std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+
+	for (std::string& s : strs)
+		s.insert(0, "https://www.example.com/articles/2024/");
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::vector<std::string> strs_ = strs;
+		state.ResumeTiming();
+
+		if (state.range(2) == 0)
+			str::sort(strs_);
+		else
+			std::sort(strs_.begin(), strs_.end());
+
+		benchmark::DoNotOptimize(strs_.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_sort_shared_prefix)->ArgsProduct({ { some_strs, many_strs }, { 0 }, { 0, 1 } })->ArgNames({ "strs", "non_ascii", "std" });
+
+static void BM_glob_filter(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+	const str::glob pattern("*[aeiou]?x*", false);
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::filter(strs, pattern));
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_glob_filter)->Apply(strs_args);
+
+static void BM_fuzzy_search(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::fuzzy_search("kitten", strs, 10));
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_fuzzy_search)->Apply(strs_args);
+
+static void BM_batch(benchmark::State& state)
+{
+	const std::vector<std::string> strs = make_strs(state.range(0), state.range(1));
+	const std::vector<str::batch_operation> operations = { [](std::string& s) { s.assign(str::trim_view(s)); }, [](std::string& s) { std::transform(s.begin(), s.end(), s.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); }); } };
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(str::batch(strs, operations));
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_batch)->Apply(strs_args);
+
+// runs a parallel algorithm inside a batch operation, which lets the waiting thread transform other chunks of the batch meanwhile, and checks that every result is still the one of its own input.
+static void BM_batch_nested(benchmark::State& state)
+{
+	std::vector<std::string> strs(static_cast<size_t>(state.range(0)));
+	std::string text(2 << 20, 'x');
+
+	for (size_t i = 0; i < strs.size(); ++i)
+		strs[i] = "item" + std::to_string(i);
+
+	text[text.length() / 2] = '!';
+
+	const std::vector<str::batch_operation> operations = { [&](std::string& s) { s.append(str::parallel_count(text, "!"), '!'); } };
+
+	for (auto _ : state)
+	{
+		const str::batch_result result = str::batch(strs, operations);
+
+		for (size_t i = 0; i < strs.size(); ++i)
+			if (result[i] != strs[i] + "!")
+			{
+				state.SkipWithError("a batch result does not match its input");
+
+				return;
+			}
+	}
+
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_batch_nested)->Arg(16384)->ArgName("strs")->Iterations(1);
+
+BENCHMARK_MAIN();
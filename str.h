@@ -42,25 +42,132 @@ SOFTWARE.
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <iterator>
+#include <cerrno>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <exception>
+#include <type_traits>
+#include <tuple>
+
+// The execution policies of the C++17 parallel algorithms, accepted by the batch transformations of this library. They are opt-in (by defining STR_EXECUTION) except on MSVC, because the parallel algorithms of libstdc++ require linking with TBB.
+#if defined(_MSC_VER) && !defined(STR_EXECUTION)
+#define STR_EXECUTION
+#endif
+#if defined(STR_EXECUTION)
+#include <execution>
+#endif
+
+// The instrumentation layer, which counts the calls, allocations and copies made by the basic operations of extended strings (see (str::instrumentation)). It is enabled by defining STR_INSTRUMENTATION, and costs nothing otherwise: the operations record their counts through STR_RECORD, which compiles out together with its arguments (some of which take time to compute, such as the capacity an append will allocate).
+#if defined(STR_INSTRUMENTATION)
+constexpr bool str_instrumentation_enabled = true;
+#define STR_RECORD(...) record(__VA_ARGS__)
+#else
+constexpr bool str_instrumentation_enabled = false;
+#define STR_RECORD(...) static_cast<void>(0)
+#endif
+
+// The vector instruction sets available to the kernels of this library, as enabled by the compiler options (for example, /arch:AVX2 on MSVC or -mavx2 on GCC and Clang). Every kernel has a scalar fallback.
+#if defined(__AVX512BW__) && defined(__AVX512VBMI2__)
+#define STR_AVX512
+#endif
+#if defined(__AVX2__)
+#define STR_AVX2
+#endif
+#if defined(__SSSE3__) || defined(__AVX__) || defined(STR_AVX2)
+#define STR_SSSE3
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STR_SSE2
+#endif
+#if defined(STR_AVX2) || defined(STR_SSE2)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// The file interfaces of the operating system, used by the file readers and writers of this library to bypass the buffering of the standard streams.
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// returns the number of trailing zero bits of a given non-zero integer. Used to locate the first set bit of the masks built by the vector kernels of this library.
+inline unsigned trailing_zeros(const std::uint64_t bits) noexcept
+{
+#if defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanForward64(&index, bits);
+
+	return static_cast<unsigned>(index);
+#else
+	return static_cast<unsigned>(__builtin_ctzll(bits));
+#endif
+}
+// returns the number of leading zero bits of a given non-zero integer. Used to locate the last set bit of the masks built by the vector kernels of this library.
+inline unsigned leading_zeros(const std::uint64_t bits) noexcept
+{
+#if defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanReverse64(&index, bits);
+
+	return 63 - static_cast<unsigned>(index);
+#else
+	return static_cast<unsigned>(__builtin_clzll(bits));
+#endif
+}
+// returns the number of set bits of a given integer.
+inline unsigned population_count(const std::uint64_t bits) noexcept
+{
+#if defined(_MSC_VER)
+	return static_cast<unsigned>(__popcnt64(bits));
+#else
+	return static_cast<unsigned>(__builtin_popcountll(bits));
+#endif
+}
 
 // returns the character of the opposite case to a given one.
 inline char opposite_case(const char c)
 {
-	return std::isupper(c) ? std::tolower(c) : std::toupper(c);
+	const unsigned char c_ = static_cast<unsigned char>(c);
+
+	return static_cast<char>(std::isupper(c_) ? std::tolower(c_) : std::toupper(c_));
 }
 // swaps the case of a given character (assigns a given character its opposite-case counterpart).
 inline void swap_case(char& c)
 {
-	c = std::isupper(c) ? std::tolower(c) : std::toupper(c);
+	c = opposite_case(c);
 }
 
+
 // The lowercase characters representing the English vowels.
 constexpr std::array<char, 5> vowels = { 'a', 'e', 'i', 'o', 'u' };
 
 // returns whether a character represents an English vowel (any of the letters a, e, i, o, and u, including their capital counterparts). By default, The letter (y) is not considered a vowel.
 inline bool is_vowel(const char letter, const bool include_y = false)
 {
-	const char letter_l = std::tolower(letter);
+	const char letter_l = static_cast<char>(std::tolower(static_cast<unsigned char>(letter)));
 
 	if (include_y && (letter_l == 'y'))
 		return true;
@@ -76,2119 +183,9317 @@ inline bool is_consonant(const char letter, const bool is_y_vowel = false)
 // Whitespace characters, according to the default C locale
 constexpr std::initializer_list<char> whitespaces = { ' ', '\t', '\n', '\v', '\f', '\r'};
 
-// The extended string class
-class str
+// A range of Unicode code points representing uppercase letters whose lowercase counterparts are found at a fixed distance. If the stride is 2, only every other code point of the range (starting from the first) is an uppercase letter, with its lowercase counterpart following it.
+struct case_range
 {
-	// The STL string from which this extended string is constructed.
-	std::string _str;
+	char32_t first, last;
+	std::int32_t delta;
+	std::uint8_t stride;
+};
 
-	// converts a vector of STL strings to a vector of extended strings.
-	static std::vector<str> vec_strs(const std::vector<std::string>& vec_std_strs)
-	{
-		std::vector<str> vec_strs = { };
-		vec_strs.reserve(vec_std_strs.size());
+// The simple (one-to-one) case mappings of the Latin, Greek, Coptic, Cyrillic, Armenian, Georgian, Glagolitic and Deseret scripts, as well as the enclosed and fullwidth Latin letters and the Roman numerals, outside of the ASCII range.
+constexpr case_range case_ranges[] = {
+	{ 0x00C0, 0x00D6, 32, 1 }, { 0x00D8, 0x00DE, 32, 1 },
+	{ 0x0100, 0x012F, 1, 2 }, { 0x0132, 0x0137, 1, 2 }, { 0x0139, 0x0148, 1, 2 }, { 0x014A, 0x0177, 1, 2 }, { 0x0178, 0x0178, -121, 1 }, { 0x0179, 0x017E, 1, 2 },
+	{ 0x0181, 0x0181, 210, 1 }, { 0x0186, 0x0186, 206, 1 }, { 0x0189, 0x018A, 205, 1 }, { 0x018E, 0x018E, 79, 1 }, { 0x018F, 0x018F, 202, 1 }, { 0x0190, 0x0190, 203, 1 },
+	{ 0x0193, 0x0193, 205, 1 }, { 0x0194, 0x0194, 207, 1 }, { 0x0196, 0x0196, 211, 1 }, { 0x0197, 0x0197, 209, 1 }, { 0x019C, 0x019C, 211, 1 }, { 0x019D, 0x019D, 213, 1 },
+	{ 0x019F, 0x019F, 214, 1 }, { 0x01A0, 0x01A5, 1, 2 }, { 0x01CD, 0x01DC, 1, 2 }, { 0x01DE, 0x01EF, 1, 2 }, { 0x01F8, 0x021F, 1, 2 }, { 0x0222, 0x0233, 1, 2 },
+	{ 0x0386, 0x0386, 38, 1 }, { 0x0388, 0x038A, 37, 1 }, { 0x038C, 0x038C, 64, 1 }, { 0x038E, 0x038F, 63, 1 }, { 0x0391, 0x03A1, 32, 1 }, { 0x03A3, 0x03AB, 32, 1 }, { 0x03D8, 0x03EF, 1, 2 },
+	{ 0x0400, 0x040F, 80, 1 }, { 0x0410, 0x042F, 32, 1 }, { 0x0460, 0x0481, 1, 2 }, { 0x048A, 0x04BF, 1, 2 }, { 0x04C0, 0x04C0, 15, 1 }, { 0x04C1, 0x04CE, 1, 2 }, { 0x04D0, 0x052F, 1, 2 },
+	{ 0x0531, 0x0556, 48, 1 }, { 0x10A0, 0x10C5, 7264, 1 },
+	{ 0x1E00, 0x1E95, 1, 2 }, { 0x1EA0, 0x1EFF, 1, 2 },
+	{ 0x2160, 0x216F, 16, 1 }, { 0x24B6, 0x24CF, 26, 1 }, { 0x2C00, 0x2C2F, 48, 1 },
+	{ 0xA640, 0xA66D, 1, 2 }, { 0xA680, 0xA69B, 1, 2 }, { 0xFF21, 0xFF3A, 32, 1 },
+	{ 0x10400, 0x10427, 40, 1 }, { 0x10C80, 0x10CB2, 64, 1 }
+};
 
-		for (const std::string& string_ : vec_std_strs)
-			vec_strs.emplace_back(string_);
+// The code points below which the case mappings are looked up in (case_table) (those of the case ranges and their counterparts, rounded up to a whole page of 256 code points). The code points above it have no counterpart.
+constexpr char32_t case_table_limit = 0x10D00;
 
-		return vec_strs;
-	}
+// returns the number of pages of (case_table): one per page of 256 code points holding a letter of the case ranges or its counterpart, and an empty one shared by the other pages.
+constexpr size_t case_table_pages() noexcept
+{
+	std::array<bool, case_table_limit / 256> has_mappings = { };
+	size_t n_pages = 1;
 
-public:
-	// TODO: static functions that return a character array.
+	for (const case_range& range : case_ranges)
+		for (char32_t cp = range.first; cp <= range.last; cp += range.stride)
+		{
+			has_mappings[cp >> 8] = true;
+			has_mappings[static_cast<char32_t>(static_cast<std::int32_t>(cp) + range.delta) >> 8] = true;
+		}
 
-	// TODO: constructor-like static functions that return an STL string.
-	
-	// constructs an empty extended string.
-	str() = default;
-	// constructs an extended string from an STL string. By default, the entire string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
-	str(const std::string& str_, const size_t start_pos = 0, const size_t len = std::string::npos) : _str(str_.substr(start_pos, len)) {}
-	// constructs an extended string from a character array. By default, the entire array is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
-	str(const char* char_arr, const size_t pos = 0, const size_t len = std::string::npos) : _str(std::string(char_arr).substr(pos, len)) {}
-	// constructs an extended string by copying another extended string. By default, the entire extended string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
-	str(const str& other, const size_t start_pos = 0, const size_t len = std::string::npos) : _str(other._str.substr(start_pos, len)) {}
-	// constructs an extended string by moving another extended string. By default, the entire extended string is assigned, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
-	str(str&& other, const size_t start_pos = 0, const size_t len = std::string::npos) noexcept : _str(std::move(other._str))
-	{
-		if (start_pos != 0 && len != std::string::npos)
-			_str = _str.substr(start_pos, len);
-	}
-	// constructs an extended string whose character sequence is the same as that of a given initializer list of characters.
-	str(const std::initializer_list<char>& il) : _str(il) {}
-	// constructs an extended string by joining the STL strings of a given STL container using a given delimiter (space by default).
-	template<class Cont> str(const Cont& strs, const std::string& delim = " ") : _str(join(strs, delim)) {}
-	
-	// constructs an STL string by repeating a given character for a given number of times, with an optional separator placed between each two instances of the said character and an optional delimiter placed at the beginning and at the end of the string.
-	static std::string repeat(const char c, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string())
-	{
-		std::string str_ = std::string();
+	for (const bool has_mappings_ : has_mappings)
+		n_pages += has_mappings_;
 
-		for (size_t i = 0; i < n; ++i)
-		{
-			str_.push_back(c);
+	return n_pages;
+}
 
-			if (i != (n - 1))
-				str_.append(sep);
-		}
+// The case mappings of the case ranges as a two-level table, so that mapping a code point takes two lookups rather than a search of the ranges: the index of the page of each 256 code points, and the pages of the distances from their code points to their lowercase and uppercase counterparts (zero for the code points with none).
+struct case_table
+{
+	std::array<std::uint8_t, case_table_limit / 256> page_index;
+	std::array<std::array<std::int16_t, 256>, case_table_pages()> lower, upper;
+};
 
-		str_.append(delim);
+constexpr case_table case_deltas = []()
+{
+	case_table table = { };
+	size_t n_pages = 1;
 
-		return str_;
+	// returns the page of a given code point, giving its page of code points one if it has none yet.
+	const auto page_of = [&table, &n_pages](const char32_t cp)
+	{
+		std::uint8_t& page = table.page_index[cp >> 8];
 
-	}
-	// constructs an STL string by repeating a given STL string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
-	static std::string repeat(const std::string& str_, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string())
+		if (page == 0)
+			page = static_cast<std::uint8_t>(n_pages++);
+
+		return page;
+	};
+
+	// the ranges are entered last to first, so that a lowercase letter shared by the ranges is mapped by the first of them.
+	for (size_t i = std::size(case_ranges); i-- > 0;)
 	{
-		std::string str_r = std::string();
+		const case_range& range = case_ranges[i];
 
-		for (size_t i = 0; i < n; ++i)
+		for (char32_t cp = range.first; cp <= range.last; cp += range.stride)
 		{
-			str_r.append(str_);
+			const char32_t cp_l = static_cast<char32_t>(static_cast<std::int32_t>(cp) + range.delta);
 
-			if (i != (n - 1))
-				str_r.append(sep);
+			table.lower[page_of(cp)][cp & 0xFF] = static_cast<std::int16_t>(range.delta);
+			table.upper[page_of(cp_l)][cp_l & 0xFF] = static_cast<std::int16_t>(-range.delta);
 		}
+	}
 
-		str_r.append(delim);
+	return table;
+}();
 
-		return str_r;
+// returns the lowercase counterpart of a given Unicode code point, or the code point itself if it does not represent an uppercase letter (or if its lowercase counterpart is not a single code point).
+inline char32_t lower_case(const char32_t cp) noexcept
+{
+	if (cp < 0x80)
+		return (cp - U'A' < 26) ? cp + 32 : cp;
 
-	}
-	// constructs an STL string by repeating a given character array for a given number of times, with an optional separator placed between each two instances of the said array and an optional delimiter placed at the beginning and at the end of the string. 
-	static std::string repeat(const char* char_arr, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string())
-	{
-		const std::string str_r = std::string(char_arr);
+	if (cp >= case_table_limit)
+		return cp;
 
-		return repeat(str_r, n, sep, delim);
-	}
+	return static_cast<char32_t>(static_cast<std::int32_t>(cp) + case_deltas.lower[case_deltas.page_index[cp >> 8]][cp & 0xFF]);
+}
+// returns the uppercase counterpart of a given Unicode code point, or the code point itself if it does not represent a lowercase letter (or if its uppercase counterpart is not a single code point).
+inline char32_t upper_case(const char32_t cp) noexcept
+{
+	if (cp < 0x80)
+		return (cp - U'a' < 26) ? cp - 32 : cp;
 
-	// constructs an STL string by repeating a given STL string for a given number of times.
-	friend std::string operator*(const std::string& str_, size_t n);
-	// assigns the result of repeating a given STL string for a given number of times to the said string.
-	friend std::string& operator*=(std::string& str_, size_t n);
-	
-	// constructs an extended string by repeating this extended string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
-	str repeat(const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) const
-	{
-		return repeat(_str, n, sep, delim);
-	}
+	if (cp >= case_table_limit)
+		return cp;
 
-	// constructs an extended string by repeating this extended string for a given number of times.
-	str operator*(const size_t n) const
-	{
-		return repeat(n);
-	}
-	// assigns the result of repeating this extended string for a given number of times to this extended string.
-	str& operator*=(const size_t n)
-	{
-		_str = repeat(_str, n);
+	return static_cast<char32_t>(static_cast<std::int32_t>(cp) + case_deltas.upper[case_deltas.page_index[cp >> 8]][cp & 0xFF]);
+}
+// returns the Unicode code point of the opposite case to a given one.
+inline char32_t opposite_case(const char32_t cp) noexcept
+{
+	const char32_t cp_l = lower_case(cp);
 
-		return *this;
-	}
+	return (cp_l != cp) ? cp_l : upper_case(cp);
+}
 
-	// constructs an extended string by repeating a given character for a given number of times, with an optional separator placed between each two instances of the said character and an optional delimiter placed at the beginning and at the end of the string.
-	str(const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(c, n, sep, delim)) {}
-	// constructs an extended string by repeating a given STL string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
-	str(const std::string& str_, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(str_, n, sep, delim)) {}
-	// constructs an extended string by repeating a given STL string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
-	str(const char* char_arr, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(char_arr, n, sep, delim)) {}
-	// constructs an extended string by repeating a given extended string for a given number of times, with an optional separator placed between each two instances of the said extended string and an optional delimiter placed at the beginning and at the end of the string.
-	str(const str& other, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(other._str, n, sep, delim)) {}
-	
-	// constructs an STL string representing the sequence of decimal (base-10) digits representing a given number. For floating-point numbers, six digits are used to represent the non-integer part, and the trailing zeroes, if any, are omitted by default.
-	template <class Number> static std::string to_string(const Number n, const bool trim_trailing_zeroes = true)
-	{
-		std::string str_ = std::to_string(n);
+// returns the English letter upon which a given Latin letter (with or without diacritics) is based, keeping its case, or a null character if the code point does not represent a Latin letter or represents one not based on a single English letter.
+inline char base_letter(const char32_t cp) noexcept
+{
+	// The base letters of the code points U+00C0 to U+017F (the Latin-1 Supplement letters and the Latin Extended-A block).
+	constexpr char base_letters[] =
+		"AAAAAAACEEEEIIII" "DNOOOOO\0OUUUUY\0s" "aaaaaaaceeeeiiii" "dnooooo\0ouuuuy\0y"
+		"AaAaAaCcCcCcCcDd" "DdEeEeEeEeEeGgGg" "GgGgHhHhIiIiIiIi" "Ii\0\0JjKkkLlLlLlL"
+		"lLlNnNnNnnNnOoOo" "OoOoRrRrRrSsSsSs" "SsTtTtTtUuUuUuUu" "UuUuWwYyYZzZzZzs";
 
-		if (trim_trailing_zeroes && str_.find('.') != std::string::npos)
-		{
-			str_ = r_trim(str_, "0");
+	static_assert(sizeof(base_letters) == 0x180 - 0xC0 + 1, "one base letter per code point");
 
-			if (str_.back() == '.')
-				str_.pop_back();
-		}
+	if (cp < 0x80)
+		return std::isalpha(static_cast<int>(cp)) ? static_cast<char>(cp) : char();
 
-		return str_;
-	}
-	// constructs an extended string representing the sequence of decimal (base-10) digits representing a given number. For floating-point numbers, six digits are used to represent the non-integer part, and the trailing zeroes, if any, are omitted by default.
-	template<class Number> static str to_str(const Number n, const bool trim_trailing_zeroes = true)
-	{
-		return to_string(n, trim_trailing_zeroes);
-	}
+	if (cp >= 0xC0 && cp < 0x180)
+		return base_letters[cp - 0xC0];
 
-	/*
-	// constructs an STL string representing the verbal representation of a given boolean value.
-	static str to_string(const bool b, const bool capitalize_str, const std::pair<std::string, std::string>& vals_tf = { "true", "false" })
-	{
-		std::string str_ = (b ? vals_tf.first : vals_tf.second);
+	return char();
+}
 
-		if (capitalize_str)
-			str_ = capitalize_front(str_);
+// returns whether a Unicode code point represents an English vowel (any of the letters a, e, i, o, and u, including their capital counterparts), with or without diacritics. By default, The letter (y) is not considered a vowel.
+inline bool is_vowel(const char32_t letter, const bool include_y = false)
+{
+	const char letter_ = base_letter(letter);
 
-		return str_; 
-	}
-	// constructs an extended string representing the verbal representation of a given boolean value.
-	static str to_str(const bool b, const bool capitalize_str, const std::pair<std::string, std::string>& vals_tf = { "true", "false" })
-	{
-		return to_string(b, capitalize_str, vals_tf);
-	}
-	*/
+	return (letter_ != char()) && is_vowel(letter_, include_y);
+}
 
-	// Destroys this extended string.
-	~str() = default;
+// The ranges of Unicode code points representing punctuation marks outside of the ASCII range.
+constexpr std::pair<char32_t, char32_t> punct_ranges[] = {
+	{ 0x00A1, 0x00A1 }, { 0x00A7, 0x00A7 }, { 0x00AB, 0x00AB }, { 0x00B6, 0x00B7 }, { 0x00BB, 0x00BB }, { 0x00BF, 0x00BF },
+	{ 0x037E, 0x037E }, { 0x0387, 0x0387 }, { 0x055A, 0x055F }, { 0x0589, 0x058A }, { 0x060C, 0x060D }, { 0x061B, 0x061B }, { 0x061F, 0x061F }, { 0x066A, 0x066D }, { 0x06D4, 0x06D4 },
+	{ 0x0964, 0x0965 }, { 0x2010, 0x2027 }, { 0x2030, 0x205E }, { 0x2E00, 0x2E4F },
+	{ 0x3001, 0x3003 }, { 0x3008, 0x3011 }, { 0x3014, 0x301F }, { 0xFE10, 0xFE19 }, { 0xFE30, 0xFE52 }, { 0xFE54, 0xFE61 },
+	{ 0xFF01, 0xFF0F }, { 0xFF1A, 0xFF20 }, { 0xFF3B, 0xFF40 }, { 0xFF5B, 0xFF65 }
+};
 
-	// TODO: Implement friend/static function versions of (operator=) and (assign) that return an STL string.
-	
-	// copy-assigns the value of an extended string to this extended string.
-	str& operator=(const str& str_) = default;
-	// move-assigns the value of an extended string to this extended string.
-	str& operator=(str&& other) noexcept
-	{
-		if (*this != other)
-			_str = std::move(other._str);
+// returns whether a Unicode code point represents a punctuation mark. The ranges, which are sorted, are binary searched.
+inline bool is_punct(const char32_t cp) noexcept
+{
+	if (cp < 0x80)
+		return std::ispunct(static_cast<int>(cp)) != 0;
 
-		return *this;
-	}
-	// assigns the value of an STL string to this extended string.
-	str& operator=(const std::string& str_)
+	const auto range = std::upper_bound(std::begin(punct_ranges), std::end(punct_ranges), cp, [](const char32_t cp_, const std::pair<char32_t, char32_t>& range_)
 	{
-		*this = str(str_);
+		return cp_ < range_.first;
+	});
 
-		return *this;
-	}
-	// assigns the value of a character array to this extended string.
-	str& operator=(const char* char_array)
-	{
-		*this = str(char_array);
+	return range != std::begin(punct_ranges) && cp <= std::prev(range)->second;
+}
 
-		return *this;
-	}
-	// assigns the value of a character to this extended string.
-	str& operator=(const char c)
-	{
-		*this = str(c);
+/*
+decodes the UTF-8 sequence starting at a given position of a character sequence (ending at a given position) into a Unicode code point, and returns the number of bytes that the sequence occupies.
 
-		return *this;
-	}
-	// assigns the character sequence represented by an initializer list of characters to this extended string.
-	str& operator=(const std::initializer_list<char>& il)
-	{
-		*this = str(il);
+if the sequence is invalid (truncated, overlong, encoding a surrogate or a code point beyond U+10FFFF, or starting with a continuation byte), the function returns 0 and the code point is set to the replacement character (U+FFFD).
+*/
+inline size_t utf8_decode(const char* pos, const char* end, char32_t& cp) noexcept
+{
+	const unsigned char lead = static_cast<unsigned char>(*pos);
 
-		return *this;
-	}
-	
-	// copy-assigns the value of an extended string to this extended string. By default, the entire extended string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
-	str& assign(const str& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
-	{
-		return *this = str(str_, start_pos, len);
-	}
-	// move-assigns the value of an extended string to this extended string. By default, the entire extended string is moved, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
-	// TODO: Implement str& assign(str&& other, const size_t start_pos = 0, const size_t len = std::string::npos)
-	// assigns the value of an STL string to this extended string. By default, the entire string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
-	str& assign(const std::string& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
+	cp = 0xFFFD;
+
+	if (lead < 0x80)
 	{
-		return *this = str(str_, start_pos, len);
+		cp = lead;
+
+		return 1;
 	}
-	// assigns the value of a character array to this extended string. By default, the entire character array is copied, but it is possible to define a subarray by providing a starting offset and a length that includes the said offset.
-	str& assign(const char* char_arr, const size_t start_pos = 0, const size_t len = std::string::npos)
+
+	size_t len = 0;
+	char32_t cp_ = 0, min = 0;
+
+	if ((lead & 0xE0) == 0xC0)
 	{
-		return *this = str(char_arr, start_pos, len);
+		len = 2;
+		cp_ = lead & 0x1F;
+		min = 0x80;
 	}
-	// assigns the value of a character repeated a given number of times (one by default), with an optional separator placed between each two instances of the said extended string and an optional delimiter placed at the beginning and at the end, to this extended string it is a member of.
-	str& assign(const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
+	else if ((lead & 0xF0) == 0xE0)
 	{
-		return *this = str(c, n, sep, delim);
+		len = 3;
+		cp_ = lead & 0x0F;
+		min = 0x800;
 	}
-	// assigns the character sequence of a given initializer list of characters to this extended string.
-	str& assign(const std::initializer_list<char>& il)
+	else if ((lead & 0xF8) == 0xF0)
 	{
-		return *this = str(il);
+		len = 4;
+		cp_ = lead & 0x07;
+		min = 0x10000;
 	}
+	else
+		return 0;
 
-	// TODO: Implement the extended string iterator class.
-	
-	// returns a random access iterator pointing to the beginning (the first character) of this extended string.
-	std::string::iterator begin() noexcept
+	if (static_cast<size_t>(end - pos) < len)
+		return 0;
+
+	for (size_t i = 1; i < len; ++i)
 	{
-		return _str.begin();
+		const unsigned char c = static_cast<unsigned char>(pos[i]);
+
+		if ((c & 0xC0) != 0x80)
+			return 0;
+
+		cp_ = (cp_ << 6) | (c & 0x3F);
 	}
-	// returns a random access iterator pointing to the beginning (the first character) of this extended string.
-	std::string::const_iterator begin() const noexcept
+
+	if (cp_ < min || cp_ > 0x10FFFF || (cp_ >= 0xD800 && cp_ <= 0xDFFF))
+		return 0;
+
+	cp = cp_;
+
+	return len;
+}
+// encodes a given Unicode code point in UTF-8 into a given character array (which must have room for 4 characters), and returns the number of bytes written.
+inline size_t utf8_encode(const char32_t cp, char* out) noexcept
+{
+	if (cp < 0x80)
 	{
-		return _str.begin();
+		out[0] = static_cast<char>(cp);
+
+		return 1;
 	}
-	// returns a random access iterator pointing to the end (the after-the-last character) of this extended string.
-	std::string::iterator end() noexcept
+	if (cp < 0x800)
 	{
-		return _str.end();
+		out[0] = static_cast<char>(0xC0 | (cp >> 6));
+		out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+
+		return 2;
 	}
-	// returns a random access iterator pointing to the end (the after-the-last character) of this extended string.
-	std::string::const_iterator end() const noexcept
+	if (cp < 0x10000)
 	{
-		return _str.end();
+		out[0] = static_cast<char>(0xE0 | (cp >> 12));
+		out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+		out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+
+		return 3;
 	}
 
-	// returns a reverse random access iterator pointing to the reverse beginning (the last character) of this extended string.
-	std::string::reverse_iterator rbegin() noexcept
+	out[0] = static_cast<char>(0xF0 | (cp >> 18));
+	out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+	out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+	out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+
+	return 4;
+}
+
+// returns the number of leading characters of a given character array (of a given length) that are ASCII characters (have values below 128), examining 32 or 16 characters at a time where vector instructions are available.
+inline size_t ascii_prefix_length(const char* chars, const size_t len) noexcept
+{
+	size_t i = 0;
+
+#if defined(STR_AVX2)
+	for (; i + 32 <= len; i += 32)
 	{
-		return _str.rbegin();
+		const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + i))));
+
+		if (mask != 0)
+			return i + trailing_zeros(mask);
 	}
-	// returns a reverse random access iterator pointing to the reverse beginning (the last character) of this extended string.
-	std::string::const_reverse_iterator rbegin() const noexcept
+#endif
+#if defined(STR_SSE2)
+	for (; i + 16 <= len; i += 16)
 	{
-		return _str.rbegin();
-	}
-	// returns a reverse random access iterator pointing to the reverse end (the before-the-first character) of this extended string.
-	std::string::reverse_iterator rend() noexcept
-	{
-		return _str.rend();
-	}
-	// returns a reverse random access iterator pointing to the reverse end (the before-the-first character) of this extended string.
-	std::string::const_reverse_iterator rend() const noexcept
-	{
-		return _str.rend();
+		const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i))));
+
+		if (mask != 0)
+			return i + trailing_zeros(mask);
 	}
+#endif
+	for (; i < len && static_cast<unsigned char>(chars[i]) < 0x80; ++i);
 
-	// returns a random access iterator pointing to the beginning (the first character) of this extended string, where the said character is constant (cannot be modified through the iterator returned).
-	std::string::const_iterator cbegin() const noexcept
-	{
-		return _str.cbegin();
-	}
-	// returns a random access iterator pointing to the end (the after-the-last character) of this extended string. where the said character is constant (cannot be modified through the iterator returned).
-	std::string::const_iterator cend() const noexcept
-	{
-		return _str.cend();
-	}
+	return i;
+}
 
-	// returns a reverse random access iterator pointing to the reverse beginning (the last character) of this extended string, where the said character is constant (cannot be modified through the iterator returned).
-	std::string::const_reverse_iterator crbegin() const noexcept
-	{
-		return _str.crbegin();
-	}
-	// returns a reverse random access iterator pointing to the reverse end (the before-the-first character) of this extended string, where the said character is constant (cannot be modified through the iterator returned).
-	std::string::const_reverse_iterator crend() const noexcept
-	{
-		return _str.crend();
-	}
+// The extended string class
+class str
+{
+	// The STL string from which this extended string is constructed.
+	std::string _str;
 
-	// gets the STL string upon which this extended string is built.
-	std::string get_str() const
-	{
-		return _str;
-	}
-	// gets the STL string upon which this extended string is built.
-	std::string get_content() const
+	// converts a vector of STL strings to a vector of extended strings.
+	static std::vector<str> vec_strs(const std::vector<std::string>& vec_std_strs)
 	{
-		return _str;
-	}
+		std::vector<str> vec_strs = { };
+		vec_strs.reserve(vec_std_strs.size());
 
-	// sets the STL string upon which this extended string is built.
-	void set_str(const std::string& str_)
-	{
-		_str = str_;
-	}
-	// sets the STL string upon which this extended string is built.
-	void set_content(const std::string& content)
-	{
-		_str = content;
+		for (const std::string& string_ : vec_std_strs)
+			vec_strs.emplace_back(string_);
+
+		return vec_strs;
 	}
 
-	// The STL string upon which this extended string is built.
-	__declspec(property(get = get_str, put = set_str)) std::string str_;
-	// The STL string upon which this extended string is built.
-	__declspec(property(get = get_content, put = set_content)) std::string content;
+	/*
+	A pool of worker threads, shared by the parallel algorithms of this library so that threads are not created on every call.
 
-	// returns a const-reference to the character array equivalent to this extended string (that is, an array of the same characters in the same order with the last element being the null terminator).
-	const char* c_str() const noexcept
-	{
-		return _str.c_str();
-	}
-	// returns a const-reference to the character array equivalent to this extended string (that is, an array of the same characters in the same order with the last element being the null terminator).
-	const char* data() const noexcept
+	each worker has its own queue of tasks: tasks submitted by a worker go to its own queue (from which it takes the most recent task first), and tasks submitted by other threads are spread across the queues round-robin. A worker whose queue is empty steals the oldest task of another queue, and sleeps when every queue is empty. A thread waiting for tasks to complete runs pending tasks in the meantime, so tasks may wait for other tasks without deadlocking the pool.
+	*/
+	class thread_pool
 	{
-		return _str.data();
-	}
+		struct task_queue
+		{
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
 
-	// returns the size (number of bytes that are occupied by the characters) of this extended string. If the said extended string contains no multibyte or variable-length characters, then the number returned by this method represents the number of characters of the said extended string.
-	size_t size() const noexcept
-	{
-		return _str.size();
-	}
-	// returns the length (number of bytes that are occupied by the characters) of this extended string. If the said extended string contains no multibyte or variable-length characters, then the number returned by this method represents the number of characters of the said extended string.
-	size_t length() const noexcept
-	{
-		return _str.length();
-	}
-	// returns the length (number of bytes that are occupied by the characters) of this extended string. If the said extended string contains no multibyte or variable-length characters, then the number returned by this method represents the number of characters of the said extended string.
-	size_t len() const noexcept
+		std::vector<std::unique_ptr<task_queue>> queues = {};
+		std::vector<std::thread> workers = {};
+
+		std::atomic<size_t> n_queued = { 0 };
+		std::atomic<size_t> next_queue = { 0 };
+		bool stopping = false;
+		std::mutex sleep_mutex = {};
+		std::condition_variable wake = {};
+
+		// returns the index of the worker running on the calling thread, or (npos) if the calling thread is not a worker.
+		static size_t& worker_index() noexcept
+		{
+			static thread_local size_t index = std::string::npos;
+
+			return index;
+		}
+
+		// pops a task from the back (the most recent task) or the front (the oldest task) of a given queue, and returns whether there was one.
+		bool pop(const size_t queue, const bool oldest, std::function<void()>& task)
+		{
+			task_queue& queue_ = *queues[queue];
+			std::lock_guard<std::mutex> lock(queue_.mutex);
+
+			if (queue_.tasks.empty())
+				return false;
+
+			if (oldest)
+			{
+				task = std::move(queue_.tasks.front());
+				queue_.tasks.pop_front();
+			}
+			else
+			{
+				task = std::move(queue_.tasks.back());
+				queue_.tasks.pop_back();
+			}
+
+			return true;
+		}
+
+		// runs the tasks of a given worker until the pool is destroyed.
+		void work(const size_t index)
+		{
+			worker_index() = index;
+
+			for (;;)
+			{
+				if (run_pending())
+					continue;
+
+				std::unique_lock<std::mutex> lock(sleep_mutex);
+
+				wake.wait(lock, [this] { return stopping || n_queued.load() != 0; });
+
+				if (stopping && n_queued.load() == 0)
+					return;
+			}
+		}
+
+	public:
+		// starts a given number of workers (at least one).
+		explicit thread_pool(const size_t n_workers)
+		{
+			for (size_t i = 0; i < std::max<size_t>(n_workers, 1); ++i)
+				queues.push_back(std::make_unique<task_queue>());
+
+			for (size_t i = 0; i < queues.size(); ++i)
+				workers.emplace_back(&thread_pool::work, this, i);
+		}
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+		// runs the pending tasks and stops the workers.
+		~thread_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex);
+
+				stopping = true;
+			}
+
+			wake.notify_all();
+
+			for (std::thread& worker : workers)
+				worker.join();
+		}
+
+		// returns the pool shared by the library, which has one worker per hardware thread besides the calling thread.
+		static thread_pool& instance()
+		{
+			static thread_pool pool(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+
+			return pool;
+		}
+
+		// returns the number of workers.
+		size_t size() const noexcept
+		{
+			return workers.size();
+		}
+
+		// submits a given task to be run by a worker.
+		void submit(std::function<void()> task)
+		{
+			const size_t self = worker_index();
+			const size_t queue = (self != std::string::npos) ? self : next_queue++ % queues.size();
+
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex);
+
+				++n_queued;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+
+				queues[queue]->tasks.push_back(std::move(task));
+			}
+
+			wake.notify_one();
+		}
+
+		// runs a single pending task (the most recent task of the queue of the calling worker, or else the oldest task of another queue), and returns whether there was one.
+		bool run_pending()
+		{
+			const size_t self = worker_index();
+			std::function<void()> task = {};
+			bool found = (self != std::string::npos) && pop(self, false, task);
+
+			const size_t start = (self != std::string::npos) ? self + 1 : next_queue.load();
+
+			for (size_t i = 0; i < queues.size() && !found; ++i)
+				found = pop((start + i) % queues.size(), true, task);
+
+			if (!found)
+				return false;
+
+			--n_queued;
+			task();
+
+			return true;
+		}
+	};
+
+	// runs a given function once for each task index in the range [0, n_tasks), spreading the tasks across a given number of threads (by default, every worker of the shared thread pool and the calling thread). Each thread picks up the next pending task as soon as it is done with its current one, and the calling thread takes part in the work. If a task throws an exception, the pending tasks are skipped and the first exception thrown is rethrown on the calling thread.
+	template<class Func> static void parallel_for(const size_t n_tasks, Func&& func, size_t n_threads = 0)
 	{
-		return _str.length();
+		thread_pool& pool = thread_pool::instance();
+
+		if (n_threads == 0)
+			n_threads = pool.size() + 1;
+
+		n_threads = std::min(n_threads, n_tasks);
+
+		if (n_threads <= 1)
+		{
+			for (size_t i = 0; i < n_tasks; ++i)
+				func(i);
+
+			return;
+		}
+
+		std::atomic<size_t> next_task = { 0 };
+		std::atomic<size_t> n_helpers = { n_threads - 1 };
+		std::atomic<bool> failed = { false };
+		std::exception_ptr exception = nullptr;
+
+		const auto work = [&]()
+		{
+			try
+			{
+				for (size_t i = next_task++; i < n_tasks; i = next_task++)
+					func(i);
+			}
+			catch (...)
+			{
+				if (!failed.exchange(true))
+					exception = std::current_exception();
+
+				next_task = n_tasks;
+			}
+		};
+
+		for (size_t i = 1; i < n_threads; ++i)
+			pool.submit([&]()
+			{
+				work();
+				n_helpers.fetch_sub(1, std::memory_order_release);
+			});
+
+		work();
+
+		while (n_helpers.load(std::memory_order_acquire) != 0)
+			if (!pool.run_pending())
+				std::this_thread::yield();
+
+		if (exception != nullptr)
+			std::rethrow_exception(exception);
 	}
 
-	// returns the offset of the last byte of the character sequence occupied by an STL string. Useful in iteration statements.
-	static size_t last_off(const std::string& str_) noexcept
+	// returns a view of the character sequence of an extended string, an STL string, a string view or a character array.
+	static std::string_view view_of(const str& str_) noexcept
 	{
-		return str_.empty() ? 0 : str_.length() - 1;
+		return str_._str;
 	}
-	// returns the offset of the last byte of the character sequence occupied by this extended string. Useful in iteration statements.
-	size_t last_off() const noexcept
+	static std::string_view view_of(const std::string& str_) noexcept
 	{
-		return _str.empty() ? 0 : _str.length() - 1;
+		return str_;
 	}
-
-	// returns the maximum size (number of bytes that are occupied by the characters) of this extended string based on known system or library implementations, though this extended string can fail to allocate storage at any point before reaching that size.
-	size_t max_size() const noexcept
+	static std::string_view view_of(const std::string_view str_) noexcept
 	{
-		return _str.max_size();
+		return str_;
 	}
-	// returns the maximum length (number of bytes that are occupied by the characters) of this extended string based on known system or library implementations, though this extended string can fail to allocate storage at any point before reaching that size.
-	size_t max_length() const noexcept
+	static std::string_view view_of(const char* char_arr) noexcept
 	{
-		return _str.max_size();
+		return char_arr;
 	}
 
-	// resets the size (number of bytes that are occupied by the characters) of this extended string to a given size, removing any characters beyond that size or adding instances of a given character (the null terminator by default) to reach that size/length.
-	void resize(const size_t len, const char c = char())
-	{
-		_str.resize(len, c);
-	}
+	// enables a template for extended strings, STL strings and string views only (not for character arrays, which would otherwise be taken for the string by calls to members that take a character array as their first argument).
+	template<class Str> using if_string_type = std::enable_if_t<std::is_same_v<Str, str> || std::is_same_v<Str, std::string> || std::is_same_v<Str, std::string_view>, int>;
 
-	// returns whether this extended string is empty (has a size/length of zero bytes). (To clear the contents of the string, use the method (clear)).
-	bool empty() const noexcept
-	{
-		return _str.empty();
-	}
-	// returns whether this extended string is empty (has a size/length of zero bytes).
-	bool is_empty() const noexcept
-	{
-		return _str.empty();
-	}
+	// The number of positions scanned by a single task of the parallel scans, chosen so that a chunk fits in the L2 cache of most processors.
+	static constexpr size_t scan_chunk_size = 1 << 18;
 
-	// clears this extended string (resets its size/length to zero bytes, removing all characters within it). (To check whether the string is empty, use the method (empty) or (is_empty)).
-	void clear() noexcept
+	// splits the positions in the range [0, n_positions) into chunks, counts something in each chunk in parallel (with a given function taking the range [begin, end) of the chunk), and returns the sum of the counts.
+	template<class Func> static size_t parallel_scan(const size_t n_positions, Func&& count_range, const size_t n_threads)
 	{
-		_str.clear();
-	}
+		const size_t n_chunks = (n_positions + scan_chunk_size - 1) / scan_chunk_size;
+		std::vector<size_t> counts(n_chunks, 0);
 
-	// returns the capacity of (the number of bytes allocated to) the STL string upon which this extended string is built. this may be greater than or equal to the string size/length (number of bytes that are occupied by the characters of the string).
-	size_t capacity() const noexcept
-	{
-		return _str.capacity();
-	}
-	// requests that the capacity of (the number of bytes allocated to) the STL string upon which this extended string is built is changed to be adapted to a planned change in size/length up to a given number. The request does not change the size/length of the string or its value, and is only guaranteed to be fulfilled if the given size/length is greater than the current capacity of the string.
-	void reserve(const size_t len)
-	{
-		return _str.reserve(len);
+		parallel_for(n_chunks, [&](const size_t c)
+		{
+			counts[c] = count_range(c * scan_chunk_size, std::min((c + 1) * scan_chunk_size, n_positions));
+		}, n_threads);
+
+		size_t count = 0;
+
+		for (const size_t count_ : counts)
+			count += count_;
+
+		return count;
 	}
-	// requests that the capacity of (the number of bytes allocated to) the STL string upon which this extended string is built is changed to a value equal to its size/length. The request does not change the size/length of the string or its value, and is not guaranteed to be fulfilled as the string implementation may be free to optimize otherwise and leave the string with a capacity greater than its size.
-	void shrink_to_fit()
+
+	// calls a given function with the position of each occurrence of a given pattern in a given character sequence which starts in the range [begin, end), including overlapping occurrences. The occurrences are searched in a window that extends past (end) only by the length of the pattern minus one, so that occurrences crossing the end of the range are found without scanning further.
+	template<class Func> static void find_each(const std::string_view chars, const std::string_view pattern, const size_t begin, const size_t end, Func&& on_match)
 	{
-		_str.shrink_to_fit();
+		const std::string_view window = chars.substr(0, end + pattern.length() - 1);
+
+		for (size_t pos = window.find(pattern, begin); pos < end; pos = window.find(pattern, pos + 1))
+			on_match(pos);
 	}
 
-	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, a null terminator is returned.
-	char& operator[](const size_t pos)
+	// A set of delimiters known at compile time. A single delimiter is searched with (memchr), sets of up to 8 delimiters are matched 16 or 32 characters at a time with one vector compare per delimiter (combined with (or), and fully unrolled), and larger sets are matched with a lookup table.
+	template<char... Delims> struct static_delimiter_set
 	{
-		char& c = _str[pos];
+		static_assert(sizeof...(Delims) != 0, "a delimiter set must not be empty");
 
-		if (pos >= _str.length())
-			c = char();
+		static constexpr char chars[] = { Delims... };
+		static constexpr std::array<bool, 256> table = []()
+		{
+			std::array<bool, 256> table_ = { };
 
-		return c;
-	}
-	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, a null terminator is returned.
-	const char& operator[](const size_t pos) const
-	{
-		if (pos >= _str.length())
+			((table_[static_cast<unsigned char>(Delims)] = true), ...);
+
+			return table_;
+		}();
+
+		// returns whether a given character is a delimiter.
+		static constexpr bool contains(const char c) noexcept
 		{
-			static const char& c = char();
-			return c;
+			return table[static_cast<unsigned char>(c)];
+		}
+		// returns whether the set has a single delimiter (the first one).
+		static constexpr bool is_single() noexcept
+		{
+			return sizeof...(Delims) == 1;
+		}
+		// returns whether the set is matched with vector compares.
+		static constexpr bool is_vectorized() noexcept
+		{
+			return sizeof...(Delims) <= 8;
 		}
 
-		return _str[pos];
+#if defined(STR_AVX2)
+		// returns a mask of the characters of a given block which are delimiters.
+		static __m256i match(const __m256i block) noexcept
+		{
+			__m256i mask = _mm256_setzero_si256();
 
-	}
+			((mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(Delims)))), ...);
 
-	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, an out-of-range exception is thrown.
-	char& at(const size_t pos)
+			return mask;
+		}
+#endif
+#if defined(STR_SSE2)
+		// returns a mask of the characters of a given block which are delimiters.
+		static __m128i match(const __m128i block) noexcept
+		{
+			__m128i mask = _mm_setzero_si128();
+
+			((mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8(Delims)))), ...);
+
+			return mask;
+		}
+#endif
+	};
+
+	// A set of delimiters known at run time, matched as a set known at compile time is (but with the vector compares looping over the delimiters).
+	class dynamic_delimiter_set
 	{
-		return _str.at(pos);
-	}
-	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, an out-of-range exception is thrown.
-	const char& at(const size_t pos) const
-	{
-		return _str.at(pos);
-	}
+		std::array<bool, 256> table = { };
+		std::array<char, 8> chars = { };
+		size_t n_chars = 0;
 
-	// returns a reference to the first character of this extended string.
-	char& front()
-	{
-		return _str.front();
-	}
-	// returns a reference the first character of this extended string.
-	const char& front() const
+	public:
+		// constructs a set of the characters of a given STL string (or string view).
+		explicit dynamic_delimiter_set(const std::string_view delims) noexcept
+		{
+			for (const char c : delims)
+			{
+				if (table[static_cast<unsigned char>(c)])
+					continue;
+
+				table[static_cast<unsigned char>(c)] = true;
+
+				if (n_chars < chars.size())
+					chars[n_chars] = c;
+
+				++n_chars;
+			}
+		}
+
+		// returns whether a given character is a delimiter.
+		bool contains(const char c) const noexcept
+		{
+			return table[static_cast<unsigned char>(c)];
+		}
+		// returns whether the set has a single delimiter (the first one).
+		bool is_single() const noexcept
+		{
+			return n_chars == 1;
+		}
+		// returns whether the set is matched with vector compares.
+		bool is_vectorized() const noexcept
+		{
+			return n_chars != 0 && n_chars <= chars.size();
+		}
+		// returns the first delimiter of the set.
+		char first() const noexcept
+		{
+			return chars[0];
+		}
+
+#if defined(STR_AVX2)
+		// returns a mask of the characters of a given block which are delimiters.
+		__m256i match(const __m256i block) const noexcept
+		{
+			__m256i mask = _mm256_setzero_si256();
+
+			for (size_t i = 0; i < n_chars; ++i)
+				mask = _mm256_or_si256(mask, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(chars[i])));
+
+			return mask;
+		}
+#endif
+#if defined(STR_SSE2)
+		// returns a mask of the characters of a given block which are delimiters.
+		__m128i match(const __m128i block) const noexcept
+		{
+			__m128i mask = _mm_setzero_si128();
+
+			for (size_t i = 0; i < n_chars; ++i)
+				mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8(chars[i])));
+
+			return mask;
+		}
+#endif
+	};
+
+	// returns the first delimiter of a delimiter set known at compile time.
+	template<char... Delims> static constexpr char first_delim(const static_delimiter_set<Delims...>&) noexcept
 	{
-		return _str.front();
+		return static_delimiter_set<Delims...>::chars[0];
 	}
-	
-	// returns a reference to the last character of this extended string.
-	char& back()
+	template<class Delims> static char first_delim(const Delims& delims) noexcept
 	{
-		return _str.back();
+		return delims.first();
 	}
-	// returns a reference to the last character of this extended string.
-	const char& back() const
+
+	// returns a pointer to the first character in the range [pos, end) which is a delimiter of a given set (or, if (delim) is false, which is not), or (end) if there is none.
+	template<bool delim, class Delims> static const char* find_delim(const char* pos, const char* const end, const Delims& delims) noexcept
 	{
-		return _str.back();
-	}
+		if (delim && delims.is_single())
+		{
+			const void* const found = std::memchr(pos, first_delim(delims), static_cast<size_t>(end - pos));
 
-	// TODO: implement friend/static function versions of (operator+=) and (append) that return an STL string.
+			return (found != nullptr) ? static_cast<const char*>(found) : end;
+		}
 
-	// appends this extended string on its right hand side to this extended string.
-	str& operator+=(const str& str_)
-	{
-		*this = _str.append(str_._str);
+		if (delims.is_vectorized())
+		{
+#if defined(STR_AVX2)
+			for (; end - pos >= 32; pos += 32)
+			{
+				const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(delims.match(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos)))));
+				const std::uint32_t found = delim ? mask : ~mask;
 
-		return *this;
-	}
-	// appends an STL string to this extended string.
-	str& operator+=(const std::string& str_)
-	{
-		*this = _str.append(str_);
+				if (found != 0)
+					return pos + trailing_zeros(found);
+			}
+#endif
+#if defined(STR_SSE2)
+			for (; end - pos >= 16; pos += 16)
+			{
+				const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(delims.match(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)))));
+				const std::uint32_t found = delim ? mask : (~mask & 0xFFFF);
 
-		return *this;
+				if (found != 0)
+					return pos + trailing_zeros(found);
+			}
+#endif
+		}
+
+		while (pos != end && delims.contains(*pos) != delim)
+			++pos;
+
+		return pos;
 	}
-	// appends a character array to this extended string.
-	str& operator+=(const char* char_array)
+	// returns a pointer past the last character in the range [begin, end) which is a delimiter of a given set (or, if (delim) is false, which is not), or (begin) if there is none. The range is scanned backwards, as by (find_delim).
+	template<bool delim, class Delims> static const char* rfind_delim(const char* const begin, const char* end, const Delims& delims) noexcept
 	{
-		*this = _str.append(char_array);
+		if (delims.is_vectorized())
+		{
+#if defined(STR_AVX2)
+			for (; end - begin >= 32; end -= 32)
+			{
+				const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(delims.match(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(end - 32)))));
+				const std::uint32_t found = delim ? mask : ~mask;
 
-		return *this;
+				if (found != 0)
+					return end - 32 + (64 - leading_zeros(found));
+			}
+#endif
+#if defined(STR_SSE2)
+			for (; end - begin >= 16; end -= 16)
+			{
+				const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(delims.match(_mm_loadu_si128(reinterpret_cast<const __m128i*>(end - 16)))));
+				const std::uint32_t found = delim ? mask : (~mask & 0xFFFF);
+
+				if (found != 0)
+					return end - 16 + (64 - leading_zeros(found));
+			}
+#endif
+		}
+
+		while (end != begin && delims.contains(end[-1]) != delim)
+			--end;
+
+		return end;
 	}
-	// appends a character to this extended string.
-	str& operator+=(const char c)
+
+	// calls a given function with the range [first, last) of each substring (word) delimited by the delimiters of a given set in the range [pos, end). Empty substrings are left out.
+	template<class Delims, class Func> static void for_each_word(const char* pos, const char* const end, const Delims& delims, Func&& on_word)
 	{
-		_str.push_back(c);
+		while ((pos = find_delim<false>(pos, end, delims)) != end)
+		{
+			const char* const word_end = find_delim<true>(pos, end, delims);
 
-		return *this;
+			on_word(pos, word_end);
+
+			pos = word_end;
+		}
 	}
-	// appends the character sequence represented by an initializer list of characters to this extended string.
-	str& operator+=(const std::initializer_list<char>& il)
+
+	// returns the number of substrings delimited by the delimiters of a given set in a given character sequence.
+	template<class Delims> static size_t count_words(const std::string_view str_, const Delims& delims) noexcept
 	{
-		*this = _str.append(il);
+		size_t count = 0;
 
-		return *this;
+		for_each_word(str_.data(), str_.data() + str_.length(), delims, [&](const char*, const char*) { ++count; });
+
+		return count;
 	}
-	
-	// appends an extended string to this extended string. A substring can be appended by defining a start offset from the first character and the number of characters including the one at the said offset.
-	str& append(const str& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
+	// returns the substrings delimited by the delimiters of a given set in a given character sequence.
+	template<class Delims> static std::vector<std::string> split_words(const std::string_view str_, const Delims& delims)
 	{
-		_str.append(str_._str.substr(start_pos, len));
+		std::vector<std::string> words = { };
 
-		return *this;
+		for_each_word(str_.data(), str_.data() + str_.length(), delims, [&](const char* first, const char* last) { words.emplace_back(first, last); });
+
+		return words;
 	}
-	// appends an STL string to this extended string. A substring can be appended by defining a start offset from the first character and the number of characters including the one at the said offset.
-	str& append(const std::string& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
+	// returns the first character of each substring delimited by the delimiters of a given set in a given character sequence (capitalized if requested), separated by a given delimiter.
+	template<class Delims> static std::string initials_of(const std::string_view str_, const bool capitalize_init, const std::string& delim, const Delims& delims)
 	{
-		*this = _str.append(str_.substr(start_pos, len));
+		std::string initials_ = { };
 
-		return *this;
+		for_each_word(str_.data(), str_.data() + str_.length(), delims, [&](const char* first, const char*)
+		{
+			if (!initials_.empty())
+				initials_.append(delim);
+
+			initials_.push_back(capitalize_init ? static_cast<char>(std::toupper(static_cast<unsigned char>(*first))) : *first);
+		});
+
+		return initials_;
 	}
-	// appends a character array to this extended string. A subarray can be appended by defining a start offset from the first character and the number of characters including the one at the said offset.
-	str& append(const char* char_array, const size_t start_pos = 0, const size_t len = std::string::npos)
+
+public:
+	// The basic operations of extended strings counted by the instrumentation layer: constructions (from STL strings, character arrays and other sources), copy and move constructions, copy and move assignments (of extended strings), other assignments (of STL strings and character arrays), appends, extractions of the underlying STL string (by (get_str) and (get_content)) and substrings.
+	enum instrumented_operation : std::int8_t { construction = 0, copy_construction, move_construction, copy_assignment, move_assignment, assignment, appending, extraction, substring, n_instrumented_operations };
+
+	// The counts recorded for an operation: the number of calls, the number of allocations and the bytes they allocated (estimated from the capacities of the STL strings allocated), and the bytes (characters) copied.
+	struct operation_stats
 	{
-		_str.append(std::string(char_array).substr(start_pos, len));
+		size_t calls = 0, allocations = 0, bytes_allocated = 0, bytes_copied = 0;
+	};
 
-		return *this;
-	}
-	// appends a character to this extended string. The said character can be repeated for a defined number of times and a separator between each two instances of the said character, as well as a delimiter enclosing the repeated character sequence, can be defined as well.
-	str& append(const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
+	// The counts recorded for every operation at some point in time, or between two points in time.
+	struct instrumentation_snapshot
 	{
-		if (n == 1 && sep.empty() && delim.empty())
+		std::array<operation_stats, n_instrumented_operations> operations = { };
+
+		// returns the counts recorded for a given operation.
+		const operation_stats& operator[](const instrumented_operation operation) const noexcept
 		{
-			_str.push_back(c);
+			return operations[operation];
+		}
 
-			return *this;
+		// returns the sums of the counts recorded for every operation.
+		operation_stats total() const noexcept
+		{
+			operation_stats total_ = {};
+
+			for (const operation_stats& stats : operations)
+			{
+				total_.calls += stats.calls;
+				total_.allocations += stats.allocations;
+				total_.bytes_allocated += stats.bytes_allocated;
+				total_.bytes_copied += stats.bytes_copied;
+			}
+
+			return total_;
 		}
 
-		str str_ = str(c, n, sep, delim);
+		// returns the counts recorded between another (earlier) snapshot and this one.
+		instrumentation_snapshot operator-(const instrumentation_snapshot& earlier) const noexcept
+		{
+			instrumentation_snapshot difference = *this;
 
-		return append(str_);
-	}
-	// appends an initializer list of characters to this extended string.
-	str& append(const std::initializer_list<char>& il)
-	{
-		_str.append(il);
+			for (size_t i = 0; i < operations.size(); ++i)
+			{
+				difference.operations[i].calls -= earlier.operations[i].calls;
+				difference.operations[i].allocations -= earlier.operations[i].allocations;
+				difference.operations[i].bytes_allocated -= earlier.operations[i].bytes_allocated;
+				difference.operations[i].bytes_copied -= earlier.operations[i].bytes_copied;
+			}
 
-		return *this;
-	}
+			return difference;
+		}
+	};
 
-	// TODO: implement corresponding (operator+=) and (prepend) functions.
-	
-	// pushes a character into the back of (appends a character to) this extended string.
-	void push_back(const char c)
+private:
+	// The counters of an operation, shared by all threads.
+	struct operation_counters
 	{
-		_str.push_back(c);
-	}
-	// "pushes" a character into the front of (prepends a character to) this extended string.
-	void push_front(const char c)
+		std::atomic<size_t> calls = { 0 }, allocations = { 0 }, bytes_allocated = { 0 }, bytes_copied = { 0 };
+	};
+
+	// returns the counters of every operation.
+	static std::array<operation_counters, n_instrumented_operations>& counters() noexcept
 	{
-		_str = (c + _str);
+		static std::array<operation_counters, n_instrumented_operations> counters_ = {};
+
+		return counters_;
 	}
-	// "pushes" a given number of characters (one by default) into the back (by default) or the front of this extended string. (appends/prepends a given number of characters to this extended string).
-	void push(const char c, const size_t n = 1, const bool push_to_front = false)
+
+	// records a call to a given operation, the number of characters it copied, and the capacities of the STL strings it allocated (a string and a temporary one), where strings short enough to be stored inline count as no allocation. Recording is compiled out unless STR_INSTRUMENTATION is defined.
+	static void record(const instrumented_operation operation, const size_t bytes_copied = 0, const size_t capacity = 0, const size_t temporary_capacity = 0) noexcept
 	{
-		if (n >= 1)
+		if constexpr (str_instrumentation_enabled)
 		{
-			if (push_to_front)
-			{
-				for (size_t i = 1; i <= n; i++)
-					push_front(c);
-			}
-			else
-				_str.append(n, c);
+			static const size_t inline_capacity = std::string().capacity();
+
+			operation_counters& counters_ = counters()[operation];
+
+			counters_.calls.fetch_add(1, std::memory_order_relaxed);
+			counters_.bytes_copied.fetch_add(bytes_copied, std::memory_order_relaxed);
+
+			for (const size_t capacity_ : { capacity, temporary_capacity })
+				if (capacity_ > inline_capacity)
+				{
+					counters_.allocations.fetch_add(1, std::memory_order_relaxed);
+					counters_.bytes_allocated.fetch_add(capacity_ + 1, std::memory_order_relaxed);
+				}
+		}
+		else
+		{
+			static_cast<void>(operation);
+			static_cast<void>(bytes_copied);
+			static_cast<void>(capacity);
+			static_cast<void>(temporary_capacity);
 		}
 	}
 
-	// pops (removes) the last character from the back of this extended string.
-	void pop_back()
+	// returns the capacity that a given STL string will have after appending a given number of characters to it if that requires an allocation, or zero otherwise. (the capacity is planned by the capacity policy, or doubled, as the standard libraries do, unless that is not enough.)
+	static size_t grown_capacity(const std::string& str_, const size_t n) noexcept
 	{
-		_str.pop_back();
+		const size_t len = str_.length() + n;
+
+		if (len <= str_.capacity())
+			return 0;
+
+		const size_t planned = planned_capacity(str_.capacity(), len);
+
+		return (planned != 0) ? planned : std::max(len, 2 * str_.capacity());
 	}
-	// "pops" (removes) the first character from the front of this extended string.
-	void pop_front()
+
+public:
+	// returns a snapshot of the counts recorded by the instrumentation layer since the start of the program (or since they were last reset), for all threads. Every count is zero unless STR_INSTRUMENTATION is defined.
+	static instrumentation_snapshot instrumentation() noexcept
 	{
-		_str.erase(0, 1);
+		instrumentation_snapshot snapshot = {};
+
+		for (size_t i = 0; i < snapshot.operations.size(); ++i)
+		{
+			const operation_counters& counters_ = counters()[i];
+
+			snapshot.operations[i] = { counters_.calls.load(std::memory_order_relaxed), counters_.allocations.load(std::memory_order_relaxed), counters_.bytes_allocated.load(std::memory_order_relaxed), counters_.bytes_copied.load(std::memory_order_relaxed) };
+		}
+
+		return snapshot;
 	}
-	// "pops" (removes) the last (by default) or first given number of characters (one by default) from the back of this extended string.
-	void pop(const size_t n = 1, const bool pop_from_front = false)
+	// resets the counts recorded by the instrumentation layer.
+	static void reset_instrumentation() noexcept
 	{
-		if (n >= 1)
+		for (operation_counters& counters_ : counters())
 		{
-			if (pop_from_front)
-				_str.erase(0, n);
-			else
-				_str.erase(_str.length() - n, n);
+			counters_.calls = 0;
+			counters_.allocations = 0;
+			counters_.bytes_allocated = 0;
+			counters_.bytes_copied = 0;
 		}
 	}
-	
-	// Prefix decrement operator: pops (removes) the first character from the front of this extended string.
-	str& operator--()
-	{
-		_str.erase(0, 1);
 
-		return *this;
-	}
-	// Postfix decrement operator: pops (removes) the last character from the back of this extended string.
-	str operator--(int)
+	// returns the name of a given instrumented operation.
+	static const char* operation_name(const instrumented_operation operation) noexcept
 	{
-		_str.pop_back();
+		static const char* const names[n_instrumented_operations] = { "construction", "copy construction", "move construction", "copy assignment", "move assignment", "assignment", "appending", "extraction", "substring" };
 
-		return *this;
+		return names[operation];
 	}
 
-	// TODO: implement static function versions of (insert) that return an STL string.
-	
-	// inserts a given extended string before the character at a given offset of this extended string. A substring can be inserted by defining a starting offset and a length that includes the said offset.
-	str& insert(const size_t pos, const str& str_, const size_t sub_pos = 0, const size_t sub_len = std::string::npos)
+	// outputs the counts of a given instrumentation snapshot, one operation per line, to an output stream (the console by default), which is returned.
+	static std::ostream& print_instrumentation(const instrumentation_snapshot& snapshot, std::ostream& output_stream = std::cout)
 	{
-		_str.insert(pos, str_._str, sub_pos, sub_len);
+		for (size_t i = 0; i < snapshot.operations.size(); ++i)
+		{
+			const operation_stats& stats = snapshot.operations[i];
 
-		return *this;
+			output_stream << operation_name(static_cast<instrumented_operation>(i)) << ": " << stats.calls << " calls, " << stats.allocations << " allocations (" << stats.bytes_allocated << " bytes), " << stats.bytes_copied << " bytes copied\n";
+		}
+
+		return output_stream;
 	}
-	// inserts a given STL string before the character at a given offset of this extended string. A substring can be inserted by defining a starting offset and a length that includes the said offset.
-	str& insert(const size_t pos, const std::string& str_, const size_t sub_pos = 0, const size_t sub_len = std::string::npos)
+
+	// A recorder of the counts of the instrumentation layer over a scope: it takes a snapshot on construction, and on destruction stores the counts recorded since then into a given snapshot (if any). The counts include operations made by every thread.
+	class instrumentation_recorder
 	{
-		_str.insert(pos, str_, sub_pos, sub_len);
+		instrumentation_snapshot start = instrumentation();
+		instrumentation_snapshot* target = nullptr;
 
-		return *this;
+	public:
+		instrumentation_recorder() = default;
+		// constructs a recorder which stores the counts recorded over its scope into a given snapshot on destruction.
+		explicit instrumentation_recorder(instrumentation_snapshot& target_) noexcept : target(&target_) {}
+		instrumentation_recorder(const instrumentation_recorder&) = delete;
+		instrumentation_recorder& operator=(const instrumentation_recorder&) = delete;
+		~instrumentation_recorder()
+		{
+			if (target != nullptr)
+				*target = recorded();
+		}
+
+		// returns the counts recorded since this recorder was constructed.
+		instrumentation_snapshot recorded() const noexcept
+		{
+			return instrumentation() - start;
+		}
+	};
+
+	// TODO: static functions that return a character array.
+
+	// TODO: constructor-like static functions that return an STL string.
+	
+	// constructs an empty extended string.
+	str() = default;
+	// constructs an extended string from an STL string. By default, the entire string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
+	str(const std::string& str_, const size_t start_pos = 0, const size_t len = std::string::npos) : _str(str_.substr(start_pos, len))
+	{
+		STR_RECORD(construction, _str.length(), _str.capacity());
 	}
-	// inserts a given character array before the character at a given offset of this extended string. A subarray can be inserted by defining a starting offset and a length that includes the said offset.
-	str& insert(const size_t pos, const char* char_array, const size_t sub_pos = 0, const size_t sub_len = std::string::npos)
+	// constructs an extended string by moving an STL string into it, without copying its characters.
+	str(std::string&& str_) noexcept : _str(std::move(str_))
 	{
-		_str.insert(pos, std::string(char_array), sub_pos, sub_len);
-
-		return *this;
+		STR_RECORD(move_construction);
 	}
-	// inserts a given character repeated for a given number of times (one by default) before the character at a given offset of this extended string, with an optional separator placed between each two instances of the said character and an optional delimiter placed at the beginning and at the end of the string.
-	str& insert(const size_t pos, const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
+	// constructs an extended string from a character array. By default, the entire array is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
+	str(const char* char_arr, const size_t pos = 0, const size_t len = std::string::npos) : _str(std::string(char_arr).substr(pos, len))
 	{
-		std::string str_ = repeat(c, n, sep, delim);
-
-		_str.insert(pos, str_);
-
-		return *this;
+		// the whole array is copied into a temporary STL string before the substring is copied out of it.
+		STR_RECORD(construction, std::strlen(char_arr) + _str.length(), _str.capacity(), std::strlen(char_arr));
 	}
-	// inserts a given character repeated for a given number of times (one by default) before the character of this extended string pointed to by a given iterator, and returns an iterator pointing to the first character inserted.
-	std::string::iterator insert(const std::string::iterator& iter, const char c, const size_t n = 1)
+	// constructs an extended string by copying another extended string. By default, the entire extended string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
+	str(const str& other, const size_t start_pos = 0, const size_t len = std::string::npos) : _str(other._str.substr(start_pos, len))
 	{
-		return _str.insert(iter, n, c);
+		STR_RECORD(copy_construction, _str.length(), _str.capacity());
 	}
-	// inserts the character sequence of a given initializer list of characters before the character of this extended string pointed to by a given iterator.
-	str& insert(const std::string::iterator& iter, const std::initializer_list<char>& il)
+	// constructs an extended string by moving another extended string. By default, the entire extended string is assigned, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
+	str(str&& other, const size_t start_pos = 0, const size_t len = std::string::npos) noexcept : _str(std::move(other._str))
 	{
-		_str.insert(iter, il);
+		if (start_pos != 0 && len != std::string::npos)
+		{
+			_str = _str.substr(start_pos, len);
 
-		return *this;
+			STR_RECORD(move_construction, _str.length(), _str.capacity());
+		}
+		else
+			STR_RECORD(move_construction);
 	}
-
-	// swaps the values of this extended string and another extended string.
-	void swap(str& str_) noexcept
+	// constructs an extended string whose character sequence is the same as that of a given initializer list of characters.
+	str(const std::initializer_list<char>& il) : _str(il)
 	{
-		std::swap(_str, str_._str);
+		STR_RECORD(construction, _str.length(), _str.capacity());
 	}
-	// swaps the values of this extended string and an STL string.
-	void swap(std::string& str_)
+	// constructs an extended string by joining the STL strings of a given STL container using a given delimiter (space by default). (only containers of STL strings are accepted, so that other types, such as string views, are not implicitly converted to extended strings.)
+	template<class Cont, std::enable_if_t<std::is_convertible_v<decltype(*std::begin(std::declval<const Cont&>())), const std::string&>, int> = 0> str(const Cont& strs, const std::string& delim = " ") : _str(join(strs, delim))
 	{
-		std::swap(_str, str_);
+		STR_RECORD(construction, _str.length(), _str.capacity());
 	}
-	// swaps the values of this extended string and a character array.
-	void swap(char* char_array)
-	{
-		std::string str_ = char_array;
+	
+	// constructs an STL string by repeating a given character for a given number of times, with an optional separator placed between each two instances of the said character and an optional delimiter placed at the beginning and at the end of the string.
+	static std::string repeat(const char c, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string())
+	{
+		std::string str_ = std::string();
 
-		std::swap(_str, str_);
+		for (size_t i = 0; i < n; ++i)
+		{
+			str_.push_back(c);
 
-		size_t str_len = str_.length();
-		char_array = new char[str_len];
-		for (size_t i = 0; i < str_len; ++i)
-			char_array[i] = str_.at(i);
-	}
+			if (i != (n - 1))
+				str_.append(sep);
+		}
 
-	// returns the substring that starts from a given offset from the first character and spans a given number of characters starting from the said offset.
-	str substr(const size_t pos = 0, const size_t len = std::string::npos) const
-	{
-		return _str.substr(pos, len);
-	}
+		str_.append(delim);
 
-	// TODO: implement versions of (split) and (join) that take/return arrays and C++ STL containers supporting random access.
-	
-	// returns a C++ STL vector of substrings separated by a given delimiter (a space by default) in a given STL string. If the delimiter is an empty string, a vector containing the passed string is returned.
-	static std::vector<std::string> split(const std::string& str_, const std::string& delim = " ")
-	{
-		if (delim.empty())
-			return { str_ };
-		
-		size_t start_pos = 0, delim_pos = 0;
-		const size_t str_len = str_.length(), delim_len = delim.length();
+		return str_;
 
-		std::vector<std::string> substrs = {};
-		
-		substrs.reserve(str_len / delim_len + 1);
+	}
+	// constructs an STL string by repeating a given STL string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
+	static std::string repeat(const std::string& str_, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string())
+	{
+		std::string str_r = std::string();
 
-		while ((delim_pos = str_.find(delim, start_pos)) != std::string::npos)
+		for (size_t i = 0; i < n; ++i)
 		{
-			if (delim_pos != start_pos)
-				substrs.push_back(str_.substr(start_pos, delim_pos - start_pos));
+			str_r.append(str_);
 
-			start_pos = (delim_pos + delim_len);
+			if (i != (n - 1))
+				str_r.append(sep);
 		}
 
-		if (start_pos < str_len)
-			substrs.push_back(str_.substr(start_pos));
+		str_r.append(delim);
+
+		return str_r;
 
-		return substrs;
 	}
-	// returns a C++ STL vector of substrings separated by a given delimiter (a space by default) in this extended string. If the delimiter is an empty string, a vector containing the passed string is returned.
-	std::vector<str> split(const std::string& delim = " ") const
+	// constructs an STL string by repeating a given character array for a given number of times, with an optional separator placed between each two instances of the said array and an optional delimiter placed at the beginning and at the end of the string. 
+	static std::string repeat(const char* char_arr, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string())
 	{
-		return vec_strs(split(_str, delim));
+		const std::string str_r = std::string(char_arr);
+
+		return repeat(str_r, n, sep, delim);
 	}
 
-	// joins the STL strings of a given C++ STL container into one STL string, separating them using a given delimiter (a space by default), and returns the said string.
-	template<class Cont> static std::string join(const Cont& strs, const std::string& delim = " ")
+	// constructs an STL string by repeating a given STL string for a given number of times.
+	friend std::string operator*(const std::string& str_, size_t n);
+	// assigns the result of repeating a given STL string for a given number of times to the said string.
+	friend std::string& operator*=(std::string& str_, size_t n);
+	
+	// constructs an extended string by repeating this extended string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
+	str repeat(const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) const
 	{
-		std::string str_ = std::string();
-
-		for (const std::string& _str_ : strs)
-			str_.append(_str_ + delim);
-
-		return str_.substr(0, str_.length() - delim.length());
+		return repeat(_str, n, sep, delim);
 	}
 
-	// returns the STL string whose characters are the uppercase counterparts of another given STL string.
-	static std::string to_upper(const std::string& str_)
+	// constructs an extended string by repeating this extended string for a given number of times.
+	str operator*(const size_t n) const
 	{
-		std::string str_u = std::string();
-
-		for (const char& c : str_)
-			str_u.push_back(std::toupper(c));
-
-		return str_u;
+		return repeat(n);
 	}
-	// returns the STL string whose characters are the lowercase counterparts of another given STL string.
-	static std::string to_lower(const std::string& str_)
+	// assigns the result of repeating this extended string for a given number of times to this extended string.
+	str& operator*=(const size_t n)
 	{
-		std::string str_l = std::string();
-
-		for (const char& c : str_)
-			str_l.push_back(std::tolower(c));
+		_str = repeat(_str, n);
 
-		return str_l;
+		return *this;
 	}
-	// returns the STL string whose characters are the opposite case counterparts of another given STL string.
-	static std::string swap_case(const std::string& str_)
-	{
-		std::string str_s = std::string();
-
-		for (const char& c : str_)
-			str_s.push_back(opposite_case(c));
 
-		return str_s;
-	}
+	// constructs an extended string by repeating a given character for a given number of times, with an optional separator placed between each two instances of the said character and an optional delimiter placed at the beginning and at the end of the string.
+	str(const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(c, n, sep, delim)) {}
+	// constructs an extended string by repeating a given STL string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
+	str(const std::string& str_, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(str_, n, sep, delim)) {}
+	// constructs an extended string by repeating a given STL string for a given number of times, with an optional separator placed between each two instances of the said string and an optional delimiter placed at the beginning and at the end of the string.
+	str(const char* char_arr, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(char_arr, n, sep, delim)) {}
+	// constructs an extended string by repeating a given extended string for a given number of times, with an optional separator placed between each two instances of the said extended string and an optional delimiter placed at the beginning and at the end of the string.
+	str(const str& other, const size_t n, const std::string& sep = std::string(), const std::string& delim = std::string()) : _str(repeat(other._str, n, sep, delim)) {}
 	
-	// returns a capitalized version of a given STL string (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
-	static std::string capitalize_front(const std::string& str_, const bool to_lower_rest = true)
+	// constructs an STL string representing the sequence of decimal (base-10) digits representing a given number. For floating-point numbers, six digits are used to represent the non-integer part, and the trailing zeroes, if any, are omitted by default.
+	template <class Number> static std::string to_string(const Number n, const bool trim_trailing_zeroes = true)
 	{
-		const size_t len = str_.length();
-
-		std::string str_cap = std::string();
-		str_cap.reserve(len);
+		std::string str_ = std::to_string(n);
 
-		str_cap.push_back(std::toupper(str_.front()));
+		if (trim_trailing_zeroes && str_.find('.') != std::string::npos)
+		{
+			str_ = r_trim(str_, "0");
 
-		for (size_t i = 1; i < len; i++)
-			str_cap.push_back(to_lower_rest ? std::tolower(str_.at(i)) : str_.at(i));
+			if (str_.back() == '.')
+				str_.pop_back();
+		}
 
-		return str_cap;
+		return str_;
 	}
-	// returns a capitalized version of a given STL string (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
-	static std::string cap_f(const std::string& str_, const bool to_lower_rest = true)
+	// constructs an extended string representing the sequence of decimal (base-10) digits representing a given number. For floating-point numbers, six digits are used to represent the non-integer part, and the trailing zeroes, if any, are omitted by default.
+	template<class Number> static str to_str(const Number n, const bool trim_trailing_zeroes = true)
 	{
-		const size_t len = str_.length();
-
-		std::string str_cap = std::string();
-		str_cap.reserve(len);
+		return to_string(n, trim_trailing_zeroes);
+	}
 
-		str_cap.push_back(std::toupper(str_.front()));
+	/*
+	// constructs an STL string representing the verbal representation of a given boolean value.
+	static str to_string(const bool b, const bool capitalize_str, const std::pair<std::string, std::string>& vals_tf = { "true", "false" })
+	{
+		std::string str_ = (b ? vals_tf.first : vals_tf.second);
 
-		for (size_t i = 1; i < len; i++)
-			str_cap.push_back(to_lower_rest ? std::tolower(str_.at(i)) : str_.at(i));
+		if (capitalize_str)
+			str_ = capitalize_front(str_);
 
-		return str_cap;
+		return str_; 
 	}
-	
-	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
-	static std::string uncapitalize_front(const std::string& str_, const bool to_upper_rest = true)
+	// constructs an extended string representing the verbal representation of a given boolean value.
+	static str to_str(const bool b, const bool capitalize_str, const std::pair<std::string, std::string>& vals_tf = { "true", "false" })
 	{
-		const size_t len = str_.length();
+		return to_string(b, capitalize_str, vals_tf);
+	}
+	*/
 
-		std::string str_cap = std::string();
-		str_cap.reserve(len);
+	// Destroys this extended string.
+	~str() = default;
 
-		str_cap.push_back(std::tolower(str_.front()));
+	// TODO: Implement friend/static function versions of (operator=) and (assign) that return an STL string.
+	
+	// copy-assigns the value of an extended string to this extended string.
+	str& operator=(const str& str_)
+	{
+		// (the characters are copied into the buffer of this string, which is reallocated only if it is too small for them.)
+		STR_RECORD(copy_assignment, str_._str.length(), (str_._str.length() > _str.capacity()) ? std::max(str_._str.length(), 2 * _str.capacity()) : 0);
 
-		for (size_t i = 1; i < len; i++)
-			str_cap.push_back(to_upper_rest ? std::toupper(str_.at(i)) : str_.at(i));
+		_str = str_._str;
 
-		return str_cap;
+		return *this;
 	}
-	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
-	static std::string uncap_f(const std::string& str_, const bool to_upper_rest = true)
+	// move-assigns the value of an extended string to this extended string.
+	str& operator=(str&& other) noexcept
 	{
-		const size_t len = str_.length();
+		STR_RECORD(move_assignment);
 
-		std::string str_cap = std::string();
-		str_cap.reserve(len);
+		if (*this != other)
+			_str = std::move(other._str);
 
-		str_cap.push_back(std::tolower(str_.front()));
+		return *this;
+	}
+	// assigns the value of an STL string to this extended string.
+	str& operator=(const std::string& str_)
+	{
+		STR_RECORD(assignment);
 
-		for (size_t i = 1; i < len; i++)
-			str_cap.push_back(to_upper_rest ? std::toupper(str_.at(i)) : str_.at(i));
+		*this = str(str_);
 
-		return str_cap;
+		return *this;
 	}
+	// assigns the value of a character array to this extended string.
+	str& operator=(const char* char_array)
+	{
+		STR_RECORD(assignment);
+
+		*this = str(char_array);
 
-	// returns this extended string whose characters are the uppercase counterparts of this extended string.
-	str to_upper() const
+		return *this;
+	}
+	// assigns the value of a character to this extended string.
+	str& operator=(const char c)
 	{
-		return to_upper(_str);
+		*this = str(c);
+
+		return *this;
 	}
-	// returns this extended string whose characters are the lowercase counterparts of this extended string.
-	str to_lower() const
+	// assigns the character sequence represented by an initializer list of characters to this extended string.
+	str& operator=(const std::initializer_list<char>& il)
 	{
-		return to_lower(_str);
+		*this = str(il);
+
+		return *this;
 	}
-	// returns this extended string whose characters are the opposite case counterparts of this extended string.
-	str swap_case() const
+	
+	// copy-assigns the value of an extended string to this extended string. By default, the entire extended string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
+	str& assign(const str& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
 	{
-		return swap_case(_str);
+		return *this = str(str_, start_pos, len);
 	}
-	// returns a capitalized version of this extended string. (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
-	str capitalize_front(const bool to_lower_rest = true) const
+	// move-assigns the value of an extended string to this extended string. By default, the entire extended string is moved, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
+	// TODO: Implement str& assign(str&& other, const size_t start_pos = 0, const size_t len = std::string::npos)
+	// assigns the value of an STL string to this extended string. By default, the entire string is copied, but it is possible to define a substring by providing a starting offset and a length that includes the said offset.
+	str& assign(const std::string& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
 	{
-		return capitalize_front(_str, to_lower_rest);
+		return *this = str(str_, start_pos, len);
 	}
-	// returns a capitalized version of this extended string. (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
-	str cap_f(const bool to_lower_rest = true) const
+	// assigns the value of a character array to this extended string. By default, the entire character array is copied, but it is possible to define a subarray by providing a starting offset and a length that includes the said offset.
+	str& assign(const char* char_arr, const size_t start_pos = 0, const size_t len = std::string::npos)
 	{
-		return cap_f(_str, to_lower_rest);
+		return *this = str(char_arr, start_pos, len);
 	}
-	
-	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
-	str uncapitalize_front(const bool to_upper_rest = true) const
+	// assigns the value of a character repeated a given number of times (one by default), with an optional separator placed between each two instances of the said extended string and an optional delimiter placed at the beginning and at the end, to this extended string it is a member of.
+	str& assign(const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
 	{
-		return uncapitalize_front(_str, to_upper_rest);
+		return *this = str(c, n, sep, delim);
 	}
-	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
-	str uncap_f(const bool to_upper_rest = true) const
+	// assigns the character sequence of a given initializer list of characters to this extended string.
+	str& assign(const std::initializer_list<char>& il)
 	{
-		return uncap_f(_str, to_upper_rest);
+		return *this = str(il);
 	}
+
+	// TODO: Implement the extended string iterator class.
 	
-	// returns the count of uppercase alphabetical characters (capital letters) in a given STL string.
-	static size_t uppercase_count(const std::string& str_)
+	// returns a random access iterator pointing to the beginning (the first character) of this extended string.
+	std::string::iterator begin() noexcept
 	{
-		return std::count_if(str_.begin(), str_.end(), isupper);
+		return _str.begin();
 	}
-	// returns the count of lowercase alphabetical characters (small letters) in a given STL string.
-	static size_t lowercase_count(const std::string& str_)
+	// returns a random access iterator pointing to the beginning (the first character) of this extended string.
+	std::string::const_iterator begin() const noexcept
 	{
-		return std::count_if(str_.begin(), str_.end(), islower);
+		return _str.begin();
 	}
-	
-	// returns the count of uppercase alphabetical characters (capital letters) in this extended string.
-	size_t uppercase_count()
+	// returns a random access iterator pointing to the end (the after-the-last character) of this extended string.
+	std::string::iterator end() noexcept
 	{
-		return std::count_if(_str.begin(), _str.end(), isupper);
+		return _str.end();
 	}
-	// returns the count of lowercase alphabetical characters (capital letters) in this extended string.
-	size_t lowercase_count()
+	// returns a random access iterator pointing to the end (the after-the-last character) of this extended string.
+	std::string::const_iterator end() const noexcept
 	{
-		return std::count_if(_str.begin(), _str.end(), islower);
+		return _str.end();
 	}
-	
-	// returns the count of characters representing English vowels in a given STL string. By default, the letter (y) is not considered a vowel.
-	static size_t vowel_count(const std::string& str_, const bool include_y = false)
-	{
-		// TODO: use C++ STL algorithm function.
 
-		size_t count = 0;
-
-		for (const char& c : str_)
-		{
-			if (is_vowel(c, include_y))
-				count++;
-		}
-
-		return count;
+	// returns a reverse random access iterator pointing to the reverse beginning (the last character) of this extended string.
+	std::string::reverse_iterator rbegin() noexcept
+	{
+		return _str.rbegin();
 	}
-	// returns the count of characters representing English consonants in a given STL string. By default, the letter (y) is not considered a vowel.
-	static size_t consonant_count(const std::string& str_, const bool is_y_vowel = false)
+	// returns a reverse random access iterator pointing to the reverse beginning (the last character) of this extended string.
+	std::string::const_reverse_iterator rbegin() const noexcept
 	{
-		return (str_.length() - vowel_count(str_, is_y_vowel));
+		return _str.rbegin();
 	}
-
-	// returns the count of characters representing English vowels in this extended string.
-	size_t vowel_count(const bool include_y = false) const
+	// returns a reverse random access iterator pointing to the reverse end (the before-the-first character) of this extended string.
+	std::string::reverse_iterator rend() noexcept
 	{
-		return vowel_count(_str, include_y);
+		return _str.rend();
 	}
-	// returns the count of characters representing English vowels in of this extended string.
-	size_t consonant_count(const bool is_y_vowel = false) const
+	// returns a reverse random access iterator pointing to the reverse end (the before-the-first character) of this extended string.
+	std::string::const_reverse_iterator rend() const noexcept
 	{
-		return consonant_count(_str, is_y_vowel);
+		return _str.rend();
 	}
 
-	// returns the count of a given character in a given STL string. Counting is case-sensitive by default.
-	static size_t count(const std::string& str_, const char c, const bool case_sensitive = true)
+	// returns a random access iterator pointing to the beginning (the first character) of this extended string, where the said character is constant (cannot be modified through the iterator returned).
+	std::string::const_iterator cbegin() const noexcept
 	{
-		const size_t count_cs = std::count(str_.begin(), str_.end(), c);
-
-		if (case_sensitive)
-			return count_cs;
-		
-		const char _c = opposite_case(c);
-
-		return (count_cs + std::count(str_.begin(), str_.end(), _c));
+		return _str.cbegin();
 	}
-	// returns the count of a given character in this extended string. Counting is case-sensitive by default.
-	size_t count(const char c, const bool case_sensitive = true) const
+	// returns a random access iterator pointing to the end (the after-the-last character) of this extended string. where the said character is constant (cannot be modified through the iterator returned).
+	std::string::const_iterator cend() const noexcept
 	{
-		return count(_str, c, case_sensitive);
+		return _str.cend();
 	}
-	
-	// The possible space-trimming operations that can be performed on a character sequence.
-	enum trim_operation : std::int8_t { left = -1, all = 0, right = +1 };
 
-	// returns the STL string that is equivalent to another given STL string without the leading whitespaces (if any). (returns the left-trimmed version of a given STL string). A set of characters other than whitespaces can also be chosen for removal.
-	static std::string l_trim(const std::string& str_, const std::string& chars = whitespaces)
+	// returns a reverse random access iterator pointing to the reverse beginning (the last character) of this extended string, where the said character is constant (cannot be modified through the iterator returned).
+	std::string::const_reverse_iterator crbegin() const noexcept
 	{
-		const size_t start_pos = str_.find_first_not_of(chars);
-
-		return str_.substr(start_pos);
+		return _str.crbegin();
 	}
-	// returns the STL string that is equivalent to another given STL string without the leading whitespaces (if any). (returns the left-trimmed version of a given STL string).
-	static std::string trim_leading_spaces(const std::string& str_)
+	// returns a reverse random access iterator pointing to the reverse end (the before-the-first character) of this extended string, where the said character is constant (cannot be modified through the iterator returned).
+	std::string::const_reverse_iterator crend() const noexcept
 	{
-		const size_t start_pos = str_.find_first_not_of(whitespaces);
-
-		return str_.substr(start_pos);
+		return _str.crend();
 	}
 
-	// returns the STL string that is equivalent to a given STL string without the trailing spaces (if any). (returns the right-trimmed version of a given STL string). A set of characters other than whitespaces can also be chosen for removal.
-	static std::string r_trim(const std::string& str_, const std::string& chars = whitespaces)
+	// gets the STL string upon which this extended string is built.
+	std::string get_str() const
 	{
-		const size_t end_pos = str_.find_last_not_of(chars);
+		STR_RECORD(extraction, _str.length(), _str.length());
 
-		return str_.substr(0, end_pos + 1);
+		return _str;
 	}
-	// returns the STL string that is equivalent to a given STL string without the trailing spaces (if any). (returns the right-trimmed version of a given STL string).
-	static std::string trim_trailing_spaces(const std::string& str_)
+	// gets the STL string upon which this extended string is built.
+	std::string get_content() const
 	{
-		const size_t end_pos = str_.find_last_not_of(whitespaces);
+		STR_RECORD(extraction, _str.length(), _str.length());
 
-		return str_.substr(0, end_pos + 1);
+		return _str;
 	}
 
-	// returns the STL string that is equivalent to a given STL string without the leading, trailing or both leading and trailing spaces (the default) (if any). A set of characters other than whitespaces can also be chosen for removal.
-	static std::string trim(const std::string& str_, const trim_operation trim_op = all, const std::string& chars = whitespaces)
+	// sets the STL string upon which this extended string is built.
+	void set_str(const std::string& str_)
 	{
-		switch (trim_op)
-		{
-		case left:
-			return l_trim(str_, chars);
-		case right:
-			return r_trim(str_, chars);
-		case all:
-			return r_trim(l_trim(str_, chars), chars);
-		}
-
-		return str_;
+		_str = str_;
 	}
-	// returns the STL string that is equivalent to a given STL string without the leading, trailing or both leading and trailing spaces (the default) (if any).
-	static std::string trim_spaces(const std::string& str_)
+	// sets the STL string upon which this extended string is built.
+	void set_content(const std::string& content)
 	{
-		return trim(str_, all);
+		_str = content;
 	}
-	
-	// returns the extended string that is equivalent to this one without the leading spaces (if any). (returns the left-trimmed version of this extended string). A set of characters other than whitespaces can also be chosen for removal.
-	str l_trim(const std::string& chars = whitespaces) const
+
+#if defined(_MSC_VER)
+	// The STL string upon which this extended string is built. (a Microsoft extension, unavailable on other compilers, which can use (get_str) and (set_str) instead.)
+	__declspec(property(get = get_str, put = set_str)) std::string str_;
+	// The STL string upon which this extended string is built. (a Microsoft extension, unavailable on other compilers, which can use (get_content) and (set_content) instead.)
+	__declspec(property(get = get_content, put = set_content)) std::string content;
+#endif
+
+	// returns a const-reference to the character array equivalent to this extended string (that is, an array of the same characters in the same order with the last element being the null terminator).
+	const char* c_str() const noexcept
 	{
-		return l_trim(_str, chars);
+		return _str.c_str();
 	}
-	// returns this extended string that is equivalent to this one without the leading spaces (if any). (returns the left-trimmed version of this extended string).
-	str trim_leading_spaces() const
+	// returns a const-reference to the character array equivalent to this extended string (that is, an array of the same characters in the same order with the last element being the null terminator).
+	const char* data() const noexcept
 	{
-		return trim_leading_spaces(_str);
+		return _str.data();
 	}
 
-	// returns the extended string that is equivalent to this one without the trailing spaces (if any). (returns the right-trimmed version of this extended string). A set of characters other than whitespaces can also be chosen for removal.
-	str r_trim(const std::string& chars = whitespaces) const
-	{
-		return r_trim(_str, chars);
-	}
-	// returns this extended string that is equivalent to this one without the trailing spaces (if any). (returns the right-trimmed version of this extended string).
-	str trim_trailing_spaces() const
+	// returns the size (number of bytes that are occupied by the characters) of this extended string. If the said extended string contains no multibyte or variable-length characters, then the number returned by this method represents the number of characters of the said extended string.
+	size_t size() const noexcept
 	{
-		return trim_trailing_spaces(_str);
+		return _str.size();
 	}
-
-	// returns the extended string that is equivalent to this one without the leading, trailing or both leading and trailing spaces (the default) (if any). A set of characters other than whitespaces can also be chosen for removal.
-	str trim(const trim_operation trim_op = all, const std::string& chars = whitespaces) const
+	// returns the length (number of bytes that are occupied by the characters) of this extended string. If the said extended string contains no multibyte or variable-length characters, then the number returned by this method represents the number of characters of the said extended string.
+	size_t length() const noexcept
 	{
-		return trim(_str, trim_op, chars);
+		return _str.length();
 	}
-	// returns this extended string that is equivalent to this one without the leading, trailing or both leading and trailing spaces (the default) (if any).
-	str trim_spaces(const trim_operation trim_op = all) const
+	// returns the length (number of bytes that are occupied by the characters) of this extended string. If the said extended string contains no multibyte or variable-length characters, then the number returned by this method represents the number of characters of the said extended string.
+	size_t len() const noexcept
 	{
-		return trim(_str, trim_op);
+		return _str.length();
 	}
 
-	// returns the STL string that is equivalent to another, albeit without the characters representing punctuation marks.
-	static std::string depunctuate(const std::string& str_)
-	{
-		std::string depunct_str = std::string();
+private:
+#if defined(STR_AVX2)
+	/*
+	validates a given character array of a given length as UTF-8 using the lookup algorithm of Keiser and Lemire, 32 characters at a time.
 
-		for (const char& c : str_)
+	each byte is classified together with the byte preceding it by three 16-entry lookup tables (indexed by the high nibble of the preceding byte, the low nibble of the preceding byte, and the high nibble of the byte itself), whose entries are bit sets of the errors that the nibble is compatible with. The intersection of the three is non-zero only for an invalid pair of bytes (a missing or unexpected continuation byte, an overlong encoding, a surrogate, or a code point beyond U+10FFFF). The third and fourth bytes of 3- and 4-byte sequences are checked separately. Blocks of ASCII characters only check that no sequence was left incomplete by the preceding block.
+	*/
+	static bool validate_utf8_avx2(const char* chars, const size_t len) noexcept
+	{
+		constexpr char too_short = 1 << 0, too_long = 1 << 1, overlong_3 = 1 << 2, too_large = 1 << 3, surrogate = 1 << 4, overlong_2 = 1 << 5, too_large_1000 = 1 << 6, overlong_4 = 1 << 6, two_conts = static_cast<char>(1 << 7);
+		constexpr char carry = too_short | too_long | two_conts;
+
+		const __m256i byte_1_high_table = _mm256_setr_epi8(
+			too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+			two_conts, two_conts, two_conts, two_conts,
+			too_short | overlong_2, too_short, too_short | overlong_3 | surrogate, too_short | too_large | too_large_1000 | overlong_4,
+			too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+			two_conts, two_conts, two_conts, two_conts,
+			too_short | overlong_2, too_short, too_short | overlong_3 | surrogate, too_short | too_large | too_large_1000 | overlong_4);
+		const __m256i byte_1_low_table = _mm256_setr_epi8(
+			carry | overlong_3 | overlong_2 | overlong_4, carry | overlong_2, carry, carry,
+			carry | too_large, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+			carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+			carry | too_large | too_large_1000, carry | too_large | too_large_1000 | surrogate, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+			carry | overlong_3 | overlong_2 | overlong_4, carry | overlong_2, carry, carry,
+			carry | too_large, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+			carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+			carry | too_large | too_large_1000, carry | too_large | too_large_1000 | surrogate, carry | too_large | too_large_1000, carry | too_large | too_large_1000);
+		const __m256i byte_2_high_table = _mm256_setr_epi8(
+			too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+			too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4, too_long | overlong_2 | two_conts | overlong_3 | too_large,
+			too_long | overlong_2 | two_conts | surrogate | too_large, too_long | overlong_2 | two_conts | surrogate | too_large,
+			too_short, too_short, too_short, too_short,
+			too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+			too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4, too_long | overlong_2 | two_conts | overlong_3 | too_large,
+			too_long | overlong_2 | two_conts | surrogate | too_large, too_long | overlong_2 | two_conts | surrogate | too_large,
+			too_short, too_short, too_short, too_short);
+
+		// The largest values that the last three bytes of a block can have without starting a sequence that continues into the next block.
+		const __m256i max_values = _mm256_setr_epi8(
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+		const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+		__m256i error = _mm256_setzero_si256(), prev_block = _mm256_setzero_si256(), prev_incomplete = _mm256_setzero_si256();
+
+		const auto check_block = [&](const __m256i block)
 		{
-			if (!std::ispunct(c))
-				depunct_str.push_back(c);
-		}
+			if (_mm256_movemask_epi8(block) == 0)
+			{
+				error = _mm256_or_si256(error, prev_incomplete);
 
-		return depunct_str;
-	}
-	// returns the STL string that is equivalent to another, albeit without the characters representing punctuation marks.
-	static std::string remove_punct(const std::string& str_)
-	{
-		std::string depunct_str = std::string();
+				return;
+			}
 
-		for (const char& c : str_)
-		{
-			if (!ispunct(c))
-				depunct_str.push_back(c);
-		}
+			// the bytes preceding each byte of the block by 1, 2 and 3 positions, taken from the block and the one before it.
+			const __m256i prev_shifted = _mm256_permute2x128_si256(prev_block, block, 0x21);
+			const __m256i prev_1 = _mm256_alignr_epi8(block, prev_shifted, 16 - 1);
+			const __m256i prev_2 = _mm256_alignr_epi8(block, prev_shifted, 16 - 2);
+			const __m256i prev_3 = _mm256_alignr_epi8(block, prev_shifted, 16 - 3);
 
-		return depunct_str;
-	}
+			const __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev_1, 4), nibble_mask));
+			const __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev_1, nibble_mask));
+			const __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask));
+			const __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
 
-	// returns this extended string that is equivalent to this one without the characters representing punctuation marks.
-	str depunctuate() const
-	{
-		return depunctuate(_str);
-	}
-	// returns this extended string that is equivalent to this one without the characters representing punctuation marks.
-	str remove_punct() const
-	{
-		return remove_punct(_str);
-	}
+			// the bytes that must be the second or third continuation byte of a 3- or 4-byte sequence have their high bit set.
+			const __m256i is_third_byte = _mm256_subs_epu8(prev_2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+			const __m256i is_fourth_byte = _mm256_subs_epu8(prev_3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+			const __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(static_cast<char>(0x80)));
 
-	// returns an STL string containing the first character of each substring of a given STL string. By default, the substrings are delimited by whitespace characters, and the initials are separated by a space.
-	static std::string initials(const std::string& str_, const bool capitalize_init = false, const std::string& delim = " ", const std::string& delims = whitespaces)
-	{
-		if (str_.empty())
-			return {};
+			error = _mm256_or_si256(error, _mm256_xor_si256(must_be_continuation, special_cases));
+			prev_incomplete = _mm256_subs_epu8(block, max_values);
+			prev_block = block;
+		};
 
-		std::string initials = {};
+		size_t i = 0;
 
-		bool is_initial = true;
+		for (; i + 32 <= len; i += 32)
+			check_block(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + i)));
 
-		for (const char& c : str_)
+		if (i < len)
 		{
-			const bool is_delim = (delims.find(c) != std::string::npos);
+			// the last partial block is padded with null characters (which are ASCII), so incomplete sequences at its end are caught.
+			alignas(32) char last_block[32] = { };
+			std::memcpy(last_block, chars + i, len - i);
 
-			if (is_initial && !is_delim)
-			{
-				initials.push_back(capitalize_init ? std::toupper(c) : c);
-				
-				if (!delim.empty())
-					initials.append(delim);
-
-				is_initial = is_delim;
-			}
+			check_block(_mm256_load_si256(reinterpret_cast<const __m256i*>(last_block)));
 		}
 
-		size_t initials_len = initials.length(), delim_len = delim.length();
-
-		if (initials_len >= delim_len)
-		{
-			size_t del_pos = initials_len - delim_len;
-
-			if (initials.substr(del_pos) == delim)
-				initials.erase(del_pos);
-		}
+		error = _mm256_or_si256(error, prev_incomplete);
 
-		return initials;
-	}
-	// returns an extended string containing the first character of each substring of this extended string. By default, the substrings are delimited by whitespace characters, and the initials are separated by a space.
-	str initials(const bool capitalize_init = false, const std::string& delim = " ", const std::string& delims = whitespaces) const
-	{
-		return initials(_str, capitalize_init, delim, delims);
+		return _mm256_testz_si256(error, error) != 0;
 	}
+#endif
 
-	// returns an STL string equivalent to a given one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	static std::string capitalize(const std::string& str_, const std::string& delims = whitespaces)
+public:
+	// returns whether a given character sequence is valid UTF-8 (consists of complete, shortest-form sequences encoding code points up to U+10FFFF, other than surrogates). Where AVX2 instructions are available, 32 characters are validated at a time; otherwise, runs of ASCII characters are skipped 8 at a time and the rest is decoded one sequence at a time.
+	static bool is_valid_utf8(const std::string_view str_) noexcept
 	{
-		if (str_.empty())
-			return {};
+#if defined(STR_AVX2)
+		return validate_utf8_avx2(str_.data(), str_.length());
+#else
+		const char* pos = str_.data();
+		const char* const end = pos + str_.length();
 
-		std::string str_cap = {};
-		str_cap.reserve(str_.length());
+		while (pos != end)
+		{
+			if (end - pos >= 8)
+			{
+				std::uint64_t chars = 0;
+				std::memcpy(&chars, pos, 8);
 
-		bool is_initial = true;
+				if ((chars & 0x8080808080808080) == 0)
+				{
+					pos += 8;
 
-		for (const char& c : str_)
-		{
-			const bool is_delim = (delims.find(c) != std::string::npos);
+					continue;
+				}
+			}
 
-			if (is_initial && !is_delim)
-				str_cap.push_back(std::toupper(c));
-			else
-				str_cap.push_back(c);
+			char32_t cp = 0;
+			const size_t cp_len = utf8_decode(pos, end, cp);
+
+			if (cp_len == 0)
+				return false;
 
-			is_initial = is_delim;
+			pos += cp_len;
 		}
 
-		return str_cap;
+		return true;
+#endif
 	}
-	// returns an extended string equivalent this one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	str capitalize(const std::string& delims = whitespaces) const
+	// returns whether this extended string is valid UTF-8 (consists of complete, shortest-form sequences encoding code points up to U+10FFFF, other than surrogates).
+	bool is_valid_utf8() const noexcept
 	{
-		return capitalize(_str, delims);
+		return is_valid_utf8(std::string_view(_str));
 	}
 
-	// returns an STL string equivalent a given one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	static std::string title(const std::string& str_, const std::string& delims = whitespaces)
+	// returns the number of Unicode code points that a given UTF-8 string consists of (the number of its characters, as opposed to its length in bytes), by counting the bytes that are not continuation bytes, 32 or 16 at a time where vector instructions are available. For invalid UTF-8, each byte that is not a continuation byte is counted as a code point.
+	static size_t codepoint_count(const std::string_view str_) noexcept
 	{
-		if (str_.empty())
-			return {};
-
-		std::string str_cap = {};
-		str_cap.reserve(str_.length());
+		const char* const chars = str_.data();
+		const size_t len = str_.length();
 
-		bool is_initial = true;
+		size_t count = 0, i = 0;
 
-		for (const char& c : str_)
+		// continuation bytes (0x80 to 0xBF) are the bytes not greater than -65 as signed values.
+#if defined(STR_AVX2)
+		for (const __m256i limit = _mm256_set1_epi8(-65); i + 32 <= len; i += 32)
 		{
-			const bool is_delim = (delims.find(c) != std::string::npos);
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + i));
 
-			if (is_initial && !is_delim)
-				str_cap.push_back(std::toupper(c));
-			else
-				str_cap.push_back(c);
+			count += population_count(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(block, limit))));
+		}
+#endif
+#if defined(STR_SSE2)
+		for (const __m128i limit = _mm_set1_epi8(-65); i + 16 <= len; i += 16)
+		{
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
 
-			is_initial = is_delim;
+			count += population_count(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(block, limit))));
 		}
+#endif
+		for (; i < len; ++i)
+			count += ((static_cast<unsigned char>(chars[i]) & 0xC0) != 0x80);
 
-		return str_cap;
+		return count;
 	}
-	// returns an extended string whose character sequence equivalent to this one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	str title(const std::string& delims = whitespaces) const
+	// returns the number of Unicode code points that this extended string consists of, assuming it is UTF-8 (the number of its characters, as opposed to its length in bytes).
+	size_t codepoint_count() const noexcept
 	{
-		return title(_str, delims);
+		return codepoint_count(std::string_view(_str));
 	}
 
-	// returns an STL string equivalent to this one with the first character of each whitespace-delimited substring replaced by its lowercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	static std::string uncapitalize(const std::string& str_, const std::string& delims = whitespaces)
+	// A forward iterator over the Unicode code points of a UTF-8 character sequence. Invalid sequences are read one byte at a time, each as the replacement character (U+FFFD).
+	class codepoint_iterator
 	{
-		if (str_.empty())
-			return {};
-
-		std::string str_uncap = {};
-		str_uncap.reserve(str_.length());
+		const char* pos = nullptr;
+		const char* end = nullptr;
+		char32_t cp = 0;
+		size_t cp_len = 0;
 
-		bool is_initial = true;
-
-		for (const char& c : str_)
+		// decodes the code point at the current position.
+		void decode() noexcept
 		{
-			const bool is_delim = (delims.find(c) != std::string::npos);
+			if (pos != end)
+				cp_len = std::max<size_t>(utf8_decode(pos, end, cp), 1);
+		}
 
-			if (is_initial && !is_delim)
-				str_uncap.push_back(std::tolower(c));
-			else
-				str_uncap.push_back(c);
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = char32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const char32_t*;
+		using reference = const char32_t&;
+
+		// constructs a code point iterator pointing to the end of any character sequence.
+		codepoint_iterator() = default;
+		// constructs a code point iterator pointing to a given position of a character sequence that ends at another given position.
+		codepoint_iterator(const char* pos_, const char* end_) noexcept : pos(pos_), end(end_)
+		{
+			decode();
+		}
 
-			is_initial = is_delim;
+		// returns the code point that this iterator points to.
+		const char32_t& operator*() const noexcept
+		{
+			return cp;
 		}
 
-		return str_uncap;
-	}
-	// returns an extended string equivalent to this one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	str uncapitalize(const std::string& delims = whitespaces) const
-	{
-		return uncapitalize(_str, delims);
-	}
+		// returns the offset (in bytes) of the code point that this iterator points to, from a given beginning of the character sequence.
+		size_t offset(const char* begin) const noexcept
+		{
+			return static_cast<size_t>(pos - begin);
+		}
+		// returns the number of bytes that the code point that this iterator points to occupies.
+		size_t length() const noexcept
+		{
+			return cp_len;
+		}
 
-	// returns the number of whitespace-delimited substrings in a given STL string. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	static size_t word_count(const std::string& str_, const std::string& delims = whitespaces)
-	{
-		if (str_.empty())
-			return 0;
+		// advances this iterator to the next code point.
+		codepoint_iterator& operator++() noexcept
+		{
+			pos += cp_len;
+			decode();
 
-		size_t count = 0;
+			return *this;
+		}
+		// advances this iterator to the next code point, and returns a copy of it from before it was advanced.
+		codepoint_iterator operator++(int) noexcept
+		{
+			codepoint_iterator iter = *this;
+			++*this;
 
-		bool is_new_word = true;
+			return iter;
+		}
 
-		for (const char& c : str_)
+		// two code point iterators are equal if they point to the same position, where every iterator past the end of its sequence is equal to the default-constructed iterator.
+		friend bool operator==(const codepoint_iterator& iter_l, const codepoint_iterator& iter_r) noexcept
 		{
-			bool is_delim = (delims.find(c) != std::string::npos);
+			return (iter_l.pos == iter_l.end ? nullptr : iter_l.pos) == (iter_r.pos == iter_r.end ? nullptr : iter_r.pos);
+		}
+		friend bool operator!=(const codepoint_iterator& iter_l, const codepoint_iterator& iter_r) noexcept
+		{
+			return !(iter_l == iter_r);
+		}
+	};
 
-			if (is_new_word && !is_delim)
-				++count;
+	// The Unicode code points of a UTF-8 character sequence, iterable with a range-based for loop.
+	struct codepoint_range
+	{
+		std::string_view chars;
 
-			is_new_word = is_delim;
+		codepoint_iterator begin() const noexcept
+		{
+			return { chars.data(), chars.data() + chars.length() };
+		}
+		codepoint_iterator end() const noexcept
+		{
+			return { };
 		}
+	};
 
-		return count;
+	// returns the Unicode code points of a given UTF-8 character sequence, which must outlive the returned range.
+	static codepoint_range codepoints(const std::string_view str_) noexcept
+	{
+		return { str_ };
 	}
-	// returns the number of whitespace-delimited substrings in this extended string. (a delimiter or a set of delimiters other than whitespace characters can be defined).
-	size_t word_count(const std::string& delims = whitespaces) const
+	// returns the Unicode code points of this extended string, assuming it is UTF-8. The returned range is invalidated by any change to this extended string.
+	codepoint_range codepoints() const noexcept
 	{
-		return word_count(_str, delims);
+		return { _str };
 	}
 
-	// returns an STL string that is the result of reversing the order of the characters of a given one.
-	static std::string reverse(const std::string& str_)
+	// returns the offset of the last byte of the character sequence occupied by an STL string. Useful in iteration statements.
+	static size_t last_off(const std::string& str_) noexcept
 	{
-		if (str_.empty())
-			return {};
-
-		std::string str_r = {};
-		str_r.reserve(str_.length());
-
-		for (auto iter = str_.rbegin(); iter != str_.rend(); ++iter)
-			str_r.push_back(*iter);
-
-		return str_r;
+		return str_.empty() ? 0 : str_.length() - 1;
 	}
-	// returns an extended string that is the result of reversing the order of the characters of this one.
-	str reverse() const
+	// returns the offset of the last byte of the character sequence occupied by this extended string. Useful in iteration statements.
+	size_t last_off() const noexcept
 	{
-		return reverse(_str);
+		return _str.empty() ? 0 : _str.length() - 1;
 	}
 
-	// returns an STL string equivalent to a given one with the order of the substrings delimited by a given delimiter (a space by default) reversed.
-	static std::string reverse_words(const std::string& str_, const std::string& delim = " ")
+	// returns the maximum size (number of bytes that are occupied by the characters) of this extended string based on known system or library implementations, though this extended string can fail to allocate storage at any point before reaching that size.
+	size_t max_size() const noexcept
 	{
-		if (str_.empty())
-			return {};
-
-		std::vector<std::string> words = split(str_, delim);
-
-		std::string str_r = {};
-		str_r.reserve(str_.length());
-
-		for (auto iter = words.rbegin(); iter != words.rend(); ++iter)
-			str_r.append(*iter + delim);
-
-		str_r.erase(str_r.length() - delim.length());
-
-		return str_r;
+		return _str.max_size();
 	}
-	// returns an extended string equivalent to a given one with the order of the substrings delimited by a given delimiter (a space by default) reversed.
-	str reverse_words(const std::string& delim = " ") const
+	// returns the maximum length (number of bytes that are occupied by the characters) of this extended string based on known system or library implementations, though this extended string can fail to allocate storage at any point before reaching that size.
+	size_t max_length() const noexcept
 	{
-		return reverse_words(_str, delim);
+		return _str.max_size();
 	}
 
-	// TODO: static function versions of (find) that return an STL string.
-	// TODO: document (find).
-	
-	size_t find(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	// resets the size (number of bytes that are occupied by the characters) of this extended string to a given size, removing any characters beyond that size or adding instances of a given character (the null terminator by default) to reach that size/length.
+	void resize(const size_t len, const char c = char())
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find(to_lower(str_._str));
+		if (len > _str.length())
+			with_room_for(len - _str.length(), [&](std::string& str_) { str_.resize(len, c); });
+		else
+		{
+			_str.resize(len);
+			shrink_if_wasteful();
+		}
+	}
 
-		return search_in.find(str_._str);
+	// returns whether this extended string is empty (has a size/length of zero bytes). (To clear the contents of the string, use the method (clear)).
+	bool empty() const noexcept
+	{
+		return _str.empty();
 	}
-	size_t find(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// returns whether this extended string is empty (has a size/length of zero bytes).
+	bool is_empty() const noexcept
 	{
-		std::string search_in = _str.substr(pos, len);
+		return _str.empty();
+	}
 
-		if (!case_sensitive)
-			return to_lower(search_in).find(to_lower(str_));
+	// clears this extended string (resets its size/length to zero bytes, removing all characters within it). (To check whether the string is empty, use the method (empty) or (is_empty)).
+	void clear() noexcept
+	{
+		_str.clear();
+	}
 
-		return search_in.find(str_);
+	// returns the capacity of (the number of bytes allocated to) the STL string upon which this extended string is built. this may be greater than or equal to the string size/length (number of bytes that are occupied by the characters of the string).
+	size_t capacity() const noexcept
+	{
+		return _str.capacity();
 	}
-	size_t find(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// requests that the capacity of (the number of bytes allocated to) the STL string upon which this extended string is built is changed to be adapted to a planned change in size/length up to a given number. The request does not change the size/length of the string or its value, and is only guaranteed to be fulfilled if the given size/length is greater than the current capacity of the string.
+	void reserve(const size_t len)
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find(to_lower(char_arr));
-
-		return search_in.find(char_arr);
+		return _str.reserve(len);
 	}
-	size_t find(const char* char_arr, const bool case_sensitive = true, const std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	// requests that the capacity of (the number of bytes allocated to) the STL string upon which this extended string is built is changed to a value equal to its size/length. The request does not change the size/length of the string or its value, and is not guaranteed to be fulfilled as the string implementation may be free to optimize otherwise and leave the string with a capacity greater than its size.
+	void shrink_to_fit()
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find(to_lower(char_arr).c_str(), 0, n);
-		
-		return search_in.find(char_arr, 0, n);
+		_str.shrink_to_fit();
 	}
-	size_t find(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
+	// returns the number of bytes allocated to this extended string but not occupied by its characters (its capacity minus its size/length).
+	size_t unused_capacity() const noexcept
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find(std::tolower(c));
-
-		return search_in.find(c);
+		return _str.capacity() - _str.length();
 	}
 
-	size_t r_find(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	/*
+	The policy by which the capacities of extended strings grow when characters are appended or inserted, and shrink when characters are removed, shared by all extended strings (set by (set_capacity_policy)).
+
+	the default policy leaves the capacity to the STL string, whose growth is implementation-defined, and never shrinks it. Otherwise, when an append or insertion needs more room, the capacity grows by (growth_percent) percent of itself (doubling it by default) but at least by (min_growth) bytes, and at least to the new size/length, and a capacity of at least (page_threshold) bytes is rounded up to a multiple of (page_size) (if it is not zero), so that huge strings occupy whole pages. When the unused capacity left after a removal (by pop, erase_if, resize and similar) exceeds (shrink_percent) percent of the capacity (if it is not zero) and (min_shrink) bytes, the string is shrunk to fit; clear keeps the capacity, so that a cleared string can be refilled without allocating. The shrink percent should be greater than the share of a grown capacity left unused (half of it when it is doubled), so that a string does not shrink right after it grows.
+	*/
+	struct capacity_policy
 	{
-		std::string search_in = _str.substr(pos, len);
+		size_t growth_percent = 100, min_growth = 0, page_size = 0, page_threshold = 0, shrink_percent = 0, min_shrink = 0;
 
-		if (!case_sensitive)
-			return to_lower(search_in).rfind(to_lower(str_._str));
+		// returns whether this policy is the same as another.
+		bool operator==(const capacity_policy& other) const noexcept
+		{
+			return growth_percent == other.growth_percent && min_growth == other.min_growth && page_size == other.page_size && page_threshold == other.page_threshold && shrink_percent == other.shrink_percent && min_shrink == other.min_shrink;
+		}
+		bool operator!=(const capacity_policy& other) const noexcept
+		{
+			return !(*this == other);
+		}
+	};
 
-		return search_in.rfind(str_._str);
-	}
-	size_t r_find(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+private:
+	// The settings of the capacity policy, shared by all threads, and whether they differ from the default ones (so that the default policy costs a single load).
+	struct capacity_settings
 	{
-		std::string search_in = _str.substr(pos, len);
+		std::atomic<size_t> growth_percent = { 100 }, min_growth = { 0 }, page_size = { 0 }, page_threshold = { 0 }, shrink_percent = { 0 }, min_shrink = { 0 };
+		std::atomic<bool> grows = { false }, shrinks = { false };
+	};
 
-		if (!case_sensitive)
-			return to_lower(search_in).rfind(to_lower(str_));
+	// returns the settings of the capacity policy.
+	static capacity_settings& capacity_settings_() noexcept
+	{
+		static capacity_settings settings = {};
 
-		return search_in.rfind(str_);
+		return settings;
 	}
-	size_t r_find(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+
+	// returns the capacity that the capacity policy gives a string of a given capacity that needs room for a given size/length, or zero if the policy leaves it to the STL string.
+	static size_t planned_capacity(const size_t capacity, const size_t len) noexcept
 	{
-		std::string search_in = _str.substr(pos, len);
+		const capacity_settings& settings = capacity_settings_();
 
-		if (!case_sensitive)
-			return to_lower(search_in).rfind(to_lower(char_arr));
+		if (!settings.grows.load(std::memory_order_relaxed))
+			return 0;
 
-		return search_in.rfind(char_arr);
-	}
-	size_t r_find(const char* char_arr, const bool case_sensitive = true, std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
-	{
-		std::string search_in = _str.substr(pos, len);
+		const size_t growth = std::max(capacity * settings.growth_percent.load(std::memory_order_relaxed) / 100, settings.min_growth.load(std::memory_order_relaxed));
+		size_t capacity_ = std::max(len, capacity + growth);
 
-		if (!case_sensitive)
-			return to_lower(search_in).rfind(to_lower(char_arr).c_str(), 0, n);
-		
-		return search_in.rfind(char_arr, 0, n);
-	}
-	size_t r_find(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
-	{
-		const std::string search_in = _str.substr(pos, len);
+		const size_t page_size = settings.page_size.load(std::memory_order_relaxed);
 
-		if (!case_sensitive)
-			return to_lower(search_in).rfind(std::tolower(c));
+		if (page_size != 0 && capacity_ >= settings.page_threshold.load(std::memory_order_relaxed))
+			capacity_ = (capacity_ + page_size - 1) / page_size * page_size;
 
-		return search_in.rfind(c);
+		return capacity_;
 	}
 
-	size_t find_first_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	// applies a given operation, which appends or inserts a given number of characters, to the STL string of this extended string, with room made for them as the capacity policy plans. (if more room is needed, the operation is applied to a new STL string of the planned capacity that the characters are copied to, rather than reserving it, which may grow the capacity further on some standard libraries, and the previous one is released only after the operation, whose characters may come from it.)
+	template<class Operation> void with_room_for(const size_t n, Operation&& operation)
 	{
-		std::string search_in = _str.substr(pos, len);
+		if (_str.length() + n > _str.capacity())
+		{
+			const size_t capacity_ = planned_capacity(_str.capacity(), _str.length() + n);
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_of(to_lower(str_._str));
+			if (capacity_ != 0)
+			{
+				std::string grown;
+				grown.reserve(capacity_);
+				grown.append(_str);
+				operation(grown);
+				_str.swap(grown);
 
-		return search_in.find_first_of(str_._str);
+				return;
+			}
+		}
+
+		operation(_str);
 	}
-	size_t find_first_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// shrinks this extended string to fit if the capacity policy finds too much of its capacity unused. (shrinking allocates a smaller buffer, so it may fail, in which case the string is left as it was.)
+	void shrink_if_wasteful() noexcept
 	{
-		std::string search_in = _str.substr(pos, len);
+		const capacity_settings& settings = capacity_settings_();
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_of(to_lower(str_));
+		if (!settings.shrinks.load(std::memory_order_relaxed))
+			return;
 
-		return search_in.find_first_of(str_);
+		const size_t unused = unused_capacity();
+
+		if (unused > settings.min_shrink.load(std::memory_order_relaxed) && unused * 100 > settings.shrink_percent.load(std::memory_order_relaxed) * _str.capacity())
+		{
+			try
+			{
+				_str.shrink_to_fit();
+			}
+			catch (...)
+			{
+			}
+		}
 	}
-	size_t find_first_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// applies a given operation, which replaces a given number of characters of the STL string of this extended string with a given number of others, through the capacity policy: with room made for the characters added, or with the string shrunk afterwards if too much of its capacity is left unused.
+	template<class Operation> void replace_within_policy(const size_t n_removed, const size_t n_added, Operation&& operation)
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_of(to_lower(char_arr));
+		if (n_added > n_removed)
+			with_room_for(n_added - n_removed, operation);
+		else
+		{
+			operation(_str);
 
-		return search_in.find_first_of(char_arr);
+			if (n_added < n_removed)
+				shrink_if_wasteful();
+		}
 	}
-	size_t find_first_of(const char* char_arr, const bool case_sensitive = true, const std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	// returns the length of the substring of a given length (clamped to the end) at a given offset of a string of a given length, as the STL string functions taking a substring define it.
+	static constexpr size_t substr_length(const size_t len, const size_t pos, const size_t sub_len) noexcept
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_of(to_lower(char_arr).c_str(), 0, n);
-		
-		return search_in.find_first_of(char_arr, 0, n);
+		return std::min(sub_len, len - std::min(pos, len));
 	}
 
-	size_t find_last_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+public:
+	// returns the capacity policy of extended strings.
+	static capacity_policy get_capacity_policy() noexcept
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_of(to_lower(str_._str));
+		const capacity_settings& settings = capacity_settings_();
 
-		return search_in.find_first_of(str_._str);
+		return { settings.growth_percent.load(std::memory_order_relaxed), settings.min_growth.load(std::memory_order_relaxed), settings.page_size.load(std::memory_order_relaxed), settings.page_threshold.load(std::memory_order_relaxed), settings.shrink_percent.load(std::memory_order_relaxed), settings.min_shrink.load(std::memory_order_relaxed) };
 	}
-	size_t find_last_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// sets the capacity policy of extended strings (for all threads), which applies to the appends, insertions and removals that follow.
+	static void set_capacity_policy(const capacity_policy& policy) noexcept
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_of(to_lower(str_));
+		capacity_settings& settings = capacity_settings_();
+		const capacity_policy default_policy = {};
 
-		return search_in.find_last_of(str_);
+		settings.growth_percent = policy.growth_percent;
+		settings.min_growth = policy.min_growth;
+		settings.page_size = policy.page_size;
+		settings.page_threshold = policy.page_threshold;
+		settings.shrink_percent = policy.shrink_percent;
+		settings.min_shrink = policy.min_shrink;
+		settings.grows = policy.growth_percent != default_policy.growth_percent || policy.min_growth != 0 || policy.page_size != 0;
+		settings.shrinks = policy.shrink_percent != 0;
 	}
-	size_t find_last_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+
+	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, a null terminator is returned.
+	char& operator[](const size_t pos)
 	{
-		std::string search_in = _str.substr(pos, len);
+		char& c = _str[pos];
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_of(to_lower(char_arr));
+		if (pos >= _str.length())
+			c = char();
 
-		return search_in.find_last_of(char_arr);
+		return c;
 	}
-	size_t find_last_of(const char* char_arr, const bool case_sensitive = true, const std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, a null terminator is returned.
+	const char& operator[](const size_t pos) const
 	{
-		std::string search_in = _str.substr(pos, len);
+		if (pos >= _str.length())
+		{
+			static const char& c = char();
+			return c;
+		}
+
+		return _str[pos];
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_of(to_lower(char_arr).c_str(), 0, n);
-		
-		return search_in.find_last_of(char_arr, 0, n);
 	}
 
-	size_t find_first_not_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, an out-of-range exception is thrown.
+	char& at(const size_t pos)
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_not_of(to_lower(str_._str));
-
-		return search_in.find_first_not_of(str_._str);
+		return _str.at(pos);
 	}
-	size_t find_first_not_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// returns a reference to the character at a given offset from the first character of this extended string. If (pos) is greater than or equal to the string size/length, an out-of-range exception is thrown.
+	const char& at(const size_t pos) const
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_not_of(to_lower(str_));
+		return _str.at(pos);
+	}
 
-		return search_in.find_first_not_of(str_);
+	// returns a reference to the first character of this extended string.
+	char& front()
+	{
+		return _str.front();
 	}
-	size_t find_first_not_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// returns a reference the first character of this extended string.
+	const char& front() const
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_not_of(to_lower(char_arr));
-
-		return search_in.find_first_not_of(char_arr);
+		return _str.front();
 	}
-	size_t find_first_not_of(const char* char_arr, const bool case_sensitive = true, std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	
+	// returns a reference to the last character of this extended string.
+	char& back()
 	{
-		std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_not_of(to_lower(char_arr).c_str(), 0, n);
-		
-		return search_in.find_first_not_of(char_arr, 0, n);
+		return _str.back();
 	}
-	size_t find_first_not_of(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
+	// returns a reference to the last character of this extended string.
+	const char& back() const
 	{
-		const std::string search_in = _str.substr(pos, len);
-
-		if (!case_sensitive)
-			return to_lower(search_in).find_first_not_of(std::tolower(c));
-
-		return search_in.find_first_not_of(c);
+		return _str.back();
 	}
 
-	size_t find_last_not_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	// TODO: implement friend/static function versions of (operator+=) and (append) that return an STL string.
+
+	// appends this extended string on its right hand side to this extended string.
+	str& operator+=(const str& str_)
 	{
-		std::string search_in = _str.substr(pos, len);
+		STR_RECORD(appending, str_._str.length(), grown_capacity(_str, str_._str.length()));
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_not_of(to_lower(str_._str));
+		with_room_for(str_._str.length(), [&](std::string& str_r) { str_r.append(str_._str); });
 
-		return search_in.find_last_not_of(str_._str);
+		return *this;
 	}
-	size_t find_last_not_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// appends an STL string to this extended string.
+	str& operator+=(const std::string& str_)
 	{
-		std::string search_in = _str.substr(pos, len);
+		STR_RECORD(appending, str_.length(), grown_capacity(_str, str_.length()));
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_not_of(to_lower(str_));
+		with_room_for(str_.length(), [&](std::string& str_r) { str_r.append(str_); });
 
-		return search_in.find_last_not_of(str_);
+		return *this;
 	}
-	size_t find_last_not_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	// appends a character array to this extended string.
+	str& operator+=(const char* char_array)
 	{
-		std::string search_in = _str.substr(pos, len);
+		const size_t len = std::strlen(char_array);
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_not_of(to_lower(char_arr));
+		STR_RECORD(appending, len, grown_capacity(_str, len));
 
-		return search_in.find_last_not_of(char_arr);
-	}
-	size_t find_last_not_of(const char* char_arr, const bool case_sensitive = true, std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
-	{
-		std::string search_in = _str.substr(pos, len);
+		with_room_for(len, [&](std::string& str_r) { str_r.append(char_array, len); });
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_not_of(to_lower(char_arr).c_str(), 0, n);
-		
-		return search_in.find_last_not_of(char_arr, 0, n);
+		return *this;
 	}
-	size_t find_last_not_of(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
+	// appends a character to this extended string.
+	str& operator+=(const char c)
 	{
-		const std::string search_in = _str.substr(pos, len);
+		STR_RECORD(appending, 1, grown_capacity(_str, 1));
 
-		if (!case_sensitive)
-			return to_lower(search_in).find_last_not_of(std::tolower(c));
+		with_room_for(1, [&](std::string& str_r) { str_r.push_back(c); });
 
-		return search_in.find_last_not_of(c);
+		return *this;
 	}
+	// appends the character sequence represented by an initializer list of characters to this extended string.
+	str& operator+=(const std::initializer_list<char>& il)
+	{
+		with_room_for(il.size(), [&](std::string& str_r) { str_r.append(il); });
 
-	// TODO: static function versions of (replace) that return an STL string.
-	// TODO: document (replace).
+		return *this;
+	}
 	
-	str& replace(const str& replace_with, const size_t this_pos, const size_t this_len, const size_t that_pos = 0, const size_t that_len = std::string::npos)
+	// appends an extended string to this extended string. A substring can be appended by defining a start offset from the first character and the number of characters including the one at the said offset.
+	str& append(const str& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
 	{
-		_str.replace(this_pos, this_len, replace_with._str, that_pos, that_len);
+		const std::string substr_ = str_._str.substr(start_pos, len);
+
+		STR_RECORD(appending, 2 * substr_.length(), grown_capacity(_str, substr_.length()), substr_.length());
+
+		with_room_for(substr_.length(), [&](std::string& str_r) { str_r.append(substr_); });
 
 		return *this;
 	}
-	str& replace(const str& replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+	// appends an STL string to this extended string. A substring can be appended by defining a start offset from the first character and the number of characters including the one at the said offset.
+	str& append(const std::string& str_, const size_t start_pos = 0, const size_t len = std::string::npos)
 	{
-		_str.replace(this_begin, this_end, replace_with._str);
+		const std::string substr_ = str_.substr(start_pos, len);
+
+		STR_RECORD(appending, 2 * substr_.length(), grown_capacity(_str, substr_.length()), substr_.length());
+
+		with_room_for(substr_.length(), [&](std::string& str_r) { str_r.append(substr_); });
 
 		return *this;
 	}
-	str& replace(const std::string& replace_with, const size_t this_pos, const size_t this_len, const size_t that_pos = 0, const size_t that_len = std::string::npos)
+	// appends a character array to this extended string. A subarray can be appended by defining a start offset from the first character and the number of characters including the one at the said offset.
+	str& append(const char* char_array, const size_t start_pos = 0, const size_t len = std::string::npos)
 	{
-		_str.replace(this_pos, this_len, replace_with, that_pos, that_len);
+		const std::string substr_ = std::string(char_array).substr(start_pos, len);
+
+		with_room_for(substr_.length(), [&](std::string& str_r) { str_r.append(substr_); });
 
 		return *this;
 	}
-	str& replace(const std::string& replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+	// appends a character to this extended string. The said character can be repeated for a defined number of times and a separator between each two instances of the said character, as well as a delimiter enclosing the repeated character sequence, can be defined as well.
+	str& append(const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
 	{
-		_str.replace(this_begin, this_end, replace_with);
+		if (n == 1 && sep.empty() && delim.empty())
+		{
+			with_room_for(1, [&](std::string& str_r) { str_r.push_back(c); });
 
-		return *this;
+			return *this;
+		}
+
+		str str_ = str(c, n, sep, delim);
+
+		return append(str_);
 	}
-	str& replace(const char* replace_with, const size_t this_pos, const size_t this_len, const size_t that_pos = 0, const size_t that_len = std::string::npos)
+	// appends an initializer list of characters to this extended string.
+	str& append(const std::initializer_list<char>& il)
 	{
-		_str.replace(this_pos, this_len, replace_with, that_pos, that_len);
+		with_room_for(il.size(), [&](std::string& str_r) { str_r.append(il); });
 
 		return *this;
 	}
-	str& replace(const char* replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+
+	// TODO: implement corresponding (operator+=) and (prepend) functions.
+	
+	// pushes a character into the back of (appends a character to) this extended string.
+	void push_back(const char c)
+	{
+		with_room_for(1, [&](std::string& str_) { str_.push_back(c); });
+	}
+	// "pushes" a character into the front of (prepends a character to) this extended string.
+	void push_front(const char c)
+	{
+		with_room_for(1, [&](std::string& str_) { str_.insert(str_.begin(), c); });
+	}
+	// "pushes" a given number of characters (one by default) into the back (by default) or the front of this extended string. (appends/prepends a given number of characters to this extended string).
+	void push(const char c, const size_t n = 1, const bool push_to_front = false)
+	{
+		if (n >= 1)
+		{
+			if (push_to_front)
+				with_room_for(n, [&](std::string& str_) { str_.insert(0, n, c); });
+			else
+				with_room_for(n, [&](std::string& str_) { str_.append(n, c); });
+		}
+	}
+
+	// pops (removes) the last character from the back of this extended string.
+	void pop_back()
+	{
+		_str.pop_back();
+		shrink_if_wasteful();
+	}
+	// "pops" (removes) the first character from the front of this extended string.
+	void pop_front()
+	{
+		_str.erase(0, 1);
+		shrink_if_wasteful();
+	}
+	// "pops" (removes) the last (by default) or first given number of characters (one by default) from the back of this extended string.
+	void pop(const size_t n = 1, const bool pop_from_front = false)
+	{
+		if (n >= 1)
+		{
+			if (pop_from_front)
+				_str.erase(0, n);
+			else
+				_str.erase(_str.length() - n, n);
+
+			shrink_if_wasteful();
+		}
+	}
+	
+	// Prefix decrement operator: pops (removes) the first character from the front of this extended string.
+	str& operator--()
 	{
-		_str.replace(this_begin, this_end, replace_with);
+		_str.erase(0, 1);
+		shrink_if_wasteful();
 
 		return *this;
 	}
-	str& replace(const char c, const size_t this_pos, const size_t this_len, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
+	// Postfix decrement operator: pops (removes) the last character from the back of this extended string.
+	str operator--(int)
 	{
-		_str.replace(this_pos, this_len, repeat(c, n, sep, delim));
+		_str.pop_back();
+		shrink_if_wasteful();
 
 		return *this;
 	}
-	str& replace(const char c, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end, size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
+
+	// TODO: implement static function versions of (insert) that return an STL string.
+	
+	// inserts a given extended string before the character at a given offset of this extended string. A substring can be inserted by defining a starting offset and a length that includes the said offset.
+	str& insert(const size_t pos, const str& str_, const size_t sub_pos = 0, const size_t sub_len = std::string::npos)
 	{
-		_str.replace(this_begin, this_end, repeat(c, n, sep, delim));
+		with_room_for(substr_length(str_._str.length(), sub_pos, sub_len), [&](std::string& str_r) { str_r.insert(pos, str_._str, sub_pos, sub_len); });
 
 		return *this;
 	}
-	str& replace(const std::initializer_list<char> replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+	// inserts a given STL string before the character at a given offset of this extended string. A substring can be inserted by defining a starting offset and a length that includes the said offset.
+	str& insert(const size_t pos, const std::string& str_, const size_t sub_pos = 0, const size_t sub_len = std::string::npos)
 	{
-		_str.replace(this_begin, this_end, replace_with);
+		with_room_for(substr_length(str_.length(), sub_pos, sub_len), [&](std::string& str_r) { str_r.insert(pos, str_, sub_pos, sub_len); });
 
 		return *this;
 	}
-	
-	static std::string& find_and_replace(std::string& str_, const std::string& to_find, const std::string& to_replace, const bool case_sensitive = true)
+	// inserts a given character array before the character at a given offset of this extended string. A subarray can be inserted by defining a starting offset and a length that includes the said offset.
+	str& insert(const size_t pos, const char* char_array, const size_t sub_pos = 0, const size_t sub_len = std::string::npos)
 	{
-		size_t pos = case_sensitive ? str_.find(to_find) : to_lower(str_).find(to_lower(to_find));
-		const size_t len = str_.length();
+		const std::string str_(char_array);
 
-		while (pos != std::string::npos)
-		{
-			str_.replace(pos, len, to_replace);
-			pos = case_sensitive ? str_.find(to_find) : to_lower(str_).find(to_lower(to_find));
-		}
+		with_room_for(substr_length(str_.length(), sub_pos, sub_len), [&](std::string& str_r) { str_r.insert(pos, str_, sub_pos, sub_len); });
 
-		return str_;
+		return *this;
 	}
-	str& find_and_replace(const str& to_find, const str& to_replace, const bool case_sensitive = true)
+	// inserts a given character repeated for a given number of times (one by default) before the character at a given offset of this extended string, with an optional separator placed between each two instances of the said character and an optional delimiter placed at the beginning and at the end of the string.
+	str& insert(const size_t pos, const char c, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
 	{
-		size_t pos = case_sensitive ? _str.find(to_find._str) : to_lower(_str).find(to_lower(to_find._str));
-		const size_t len = length();
+		std::string str_ = repeat(c, n, sep, delim);
 
-		while (pos != std::string::npos)
-		{
-			_str.replace(pos, len, to_replace._str);
-			pos = case_sensitive ? _str.find(to_find._str) : to_lower(_str).find(to_lower(to_find._str));
-		}
+		with_room_for(str_.length(), [&](std::string& str_r) { str_r.insert(pos, str_); });
 
 		return *this;
 	}
-	
-	// TODO: static function versions of (compare) that take an STL string.
-	// TODO: document (compare).
-	
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of two STL strings . (substrings can be defined through a starting offset and a length that includes the said offset).
+	// inserts a given character repeated for a given number of times (one by default) before the character of this extended string pointed to by a given iterator, and returns an iterator pointing to the first character inserted.
+	std::string::iterator insert(const std::string::iterator& iter, const char c, const size_t n = 1)
+	{
+		const size_t pos = static_cast<size_t>(iter - _str.begin());
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal.
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const std::string& str_l, const std::string& str_r, const bool case_sensitive = true, size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos) 
+		with_room_for(n, [&](std::string& str_) { str_.insert(pos, n, c); });
+
+		return _str.begin() + static_cast<std::ptrdiff_t>(pos);
+	}
+	// inserts the character sequence of a given initializer list of characters before the character of this extended string pointed to by a given iterator.
+	str& insert(const std::string::iterator& iter, const std::initializer_list<char>& il)
 	{
-		if (case_sensitive)
-			return str_l.compare(pos_l, len_l, str_r.substr(pos_r, len_r));
+		const size_t pos = static_cast<size_t>(iter - _str.begin());
 
-		const std::string str_l_ = to_lower(str_l).substr(pos_l, len_l);
-		const std::string str_r_ = to_lower(str_r).substr(pos_r, len_r);
+		with_room_for(il.size(), [&](std::string& str_) { str_.insert(str_.begin() + static_cast<std::ptrdiff_t>(pos), il); });
 
-		return str_l_.compare(str_r);
+		return *this;
 	}
-	
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of two extended strings. (substrings can be defined through a starting offset and a length that includes the said offset).
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal.
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const str& str_l, const str& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	// swaps the values of this extended string and another extended string.
+	void swap(str& str_) noexcept
 	{
-		return compare(str_l._str, str_r._str, case_sensitive, pos_l, len_l, pos_r, len_r);
+		std::swap(_str, str_._str);
 	}
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of this extended string and another. (substrings can be defined through a starting offset and a length that includes the said offset).
-
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal.
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	int compare(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos, const size_t pos_ = 0, const size_t len_ = std::string::npos) const
+	// swaps the values of this extended string and an STL string.
+	void swap(std::string& str_)
 	{
-		return compare(*this, str_, case_sensitive, pos, len, pos_, len_);
+		std::swap(_str, str_);
 	}
+	// swaps the values of this extended string and a character array.
+	void swap(char* char_array)
+	{
+		std::string str_ = char_array;
 
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an extended string on the left hand side and an STL string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
+		std::swap(_str, str_);
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal.
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const str& str_l, const std::string& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
-	{
-		return compare(str_l._str, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
-	}
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an STL string on the left hand side and an extended string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
-
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal.
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const std::string& str_l, const str& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
-	{
-		return compare(str_l, str_r._str, case_sensitive, pos_l, len_l, pos_r, len_r);
+		size_t str_len = str_.length();
+		char_array = new char[str_len];
+		for (size_t i = 0; i < str_len; ++i)
+			char_array[i] = str_.at(i);
 	}
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of this extended string on the left hand side and an STL string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal.
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	int compare(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos, const size_t pos_ = 0, const size_t len_ = std::string::npos) const
+	// returns the substring that starts from a given offset from the first character and spans a given number of characters starting from the said offset.
+	str substr(const size_t pos = 0, const size_t len = std::string::npos) const
 	{
-		return compare(_str, str_, case_sensitive, pos, len, pos_, len_);
-	}
+		std::string substr_ = _str.substr(pos, len);
 
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of two character arrays. (sub-arrays can be defined through a starting offset and a length that includes the said offset).
+		STR_RECORD(substring, substr_.length(), substr_.length());
 
-	the returned value is:
-	(A) equal to 0
-		if the two character arrays are equal.
-	(B) smaller than zero
-		if the first character of the left-hand array that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand array that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const char* char_arr_l, const char* char_arr_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
-	{
-		const std::string str_l = char_arr_l, str_r = char_arr_r;
-		
-		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+		return substr_;
 	}
 
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an STL string on the left hand side and a character array on the right hand side. (sub-strings/sub-arrays can be defined through a starting offset and a length that includes the said offset).
-
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal.
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const std::string& str_l, const char* char_arr_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	// TODO: implement versions of (split) and (join) that take/return arrays and C++ STL containers supporting random access.
+	
+	// returns a C++ STL vector of substrings separated by a given delimiter (a space by default) in a given STL string. If the delimiter is an empty string, a vector containing the passed string is returned.
+	static std::vector<std::string> split(const std::string& str_, const std::string& delim = " ")
 	{
-		const std::string str_r = char_arr_r;
+		if (delim.empty())
+			return { str_ };
 		
-		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
-	}
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of a character array on the left hand side and an STL string on the right hand side. (sub-strings/sub-arrays can be defined through a starting offset and a length that includes the said offset).
+		size_t start_pos = 0, delim_pos = 0;
+		const size_t str_len = str_.length(), delim_len = delim.length();
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal (having the same character sequence).
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const char* char_arr_l, const std::string& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
-	{
-		const std::string str_l = char_arr_l;
+		std::vector<std::string> substrs = {};
 		
-		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
-	}
+		substrs.reserve(str_len / delim_len + 1);
 
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an extended string on the left hand side and a character array on the right hand side. (substrings/sub-arrays can be defined through a starting offset and a length that includes the said offset).
+		while ((delim_pos = str_.find(delim, start_pos)) != std::string::npos)
+		{
+			if (delim_pos != start_pos)
+				substrs.push_back(str_.substr(start_pos, delim_pos - start_pos));
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal (having the same character sequence).
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const str& str_l, const char* char_arr_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+			start_pos = (delim_pos + delim_len);
+		}
+
+		if (start_pos < str_len)
+			substrs.push_back(str_.substr(start_pos));
+
+		return substrs;
+	}
+	// returns a C++ STL vector of substrings separated by a given delimiter (a space by default) in this extended string. If the delimiter is an empty string, a vector containing the passed string is returned.
+	std::vector<str> split(const std::string& delim = " ") const
 	{
-		const std::string str_r = char_arr_r;
-		
-		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+		return vec_strs(split(_str, delim));
 	}
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of a character array on the left hand side and an extended string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal (having the same character sequence).
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	static int compare(const char* char_arr_l, const str& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	// joins the STL strings of a given C++ STL container into one STL string, separating them using a given delimiter (a space by default), and returns the said string.
+	template<class Cont> static std::string join(const Cont& strs, const std::string& delim = " ")
 	{
-		const std::string str_l = char_arr_l;
-
-		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
-	}
+		std::string str_ = std::string();
 
-	/*
-	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequence of this extended string on the left hand side with that of a character array on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
+		for (const std::string& _str_ : strs)
+			str_.append(_str_ + delim);
 
-	the returned value is:
-	(A) equal to 0
-		if the two strings are equal (having the same character sequence).
-	(B) smaller than zero
-		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
-	(C) greater than zero
-		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
-	*/
-	int compare(const char* char_arr, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos) const
-	{
-		const std::string str_ = char_arr;
-		
-		return compare(_str, str_, case_sensitive, pos_l, len_l, pos_r, len_r);
+		return str_.substr(0, str_.length() - delim.length());
 	}
 
-	// TODO: document comparison operators.
-	
-	friend bool operator==(const str&, const str&) noexcept;
-	friend bool operator==(const str&, const std::string&);
-	friend bool operator==(const str&, const char*);
-	friend bool operator==(const std::string&, const str&);
-	friend bool operator==(const char*, const str&);
-	
-	friend bool operator!=(const str&, const str&) noexcept;
-	friend bool operator!=(const str&, const std::string&);
-	friend bool operator!=(const str&, const char*);
-	friend bool operator!=(const std::string&, const str&);
-	friend bool operator!=(const char*, const str&);
+	// The orders in which a range of strings can be sorted.
+	enum sort_order : std::int8_t { lexicographic = 0, case_insensitive = 1, natural = 2 };
 
-	friend bool operator<(const str&, const str&) noexcept;
-	friend bool operator<(const str&, const std::string&);
-	friend bool operator<(const str&, const char*);
-	friend bool operator<(const std::string&, const str&);
-	friend bool operator<(const char*, const str&);
-	
-	friend bool operator<=(const str&, const str&) noexcept;
-	friend bool operator<=(const str&, const std::string&);
-	friend bool operator<=(const str&, const char*);
-	friend bool operator<=(const std::string&, const str&);
-	friend bool operator<=(const char*, const str&);
-	
-	friend bool operator>(const str&, const str&) noexcept;
-	friend bool operator>(const str&, const std::string&);
-	friend bool operator>(const str&, const char*);
-	friend bool operator>(const std::string&, const str&);
-	friend bool operator>(const std::string&, const char*);
-	friend bool operator>(const char*, const str&);
+private:
+	// A string being sorted: a view of its characters, its offset in the range being sorted, and a cache of (up to) 8 of its characters starting from a given offset, packed so that comparing two caches as integers compares the said characters.
+	struct sort_entry
+	{
+		std::uint64_t prefix;
+		size_t prefix_pos;
+		const char* chars;
+		size_t len;
+		size_t index;
+	};
 
-	friend bool operator>=(const str&, const str&) noexcept;
-	friend bool operator>=(const str&, const std::string&);
-	friend bool operator>=(const str&, const char*);
-	friend bool operator>=(const std::string&, const str&);
-	friend bool operator>=(const std::string&, const char*);
-	friend bool operator>=(const char*, const str&);
+	// A range of sort entries (given by its offset and its number of entries) whose first (depth) characters are known to be equal.
+	struct sort_range
+	{
+		size_t begin, n, depth;
+	};
 
-	// returns this extended string that is the result of concatenating two given extended strings.
-	friend str operator+(const str&, const str&);
-	// returns this extended string that is the result of concatenating an extended string with an STL string.
-	friend str operator+(const str&, const std::string&);
-	// returns this extended string that is the result of concatenating an STL string with an extended string.
-	friend str operator+(const std::string&, const str&);
-	// returns this extended string that is the result of concatenating an extended string with a character array.
-	friend str operator+(const str&, const char*);
-	// returns this extended string that is the result of concatenating a character array with an extended string.
-	friend str operator+(const char*, const str&);
-	// returns this extended string that is the result of concatenating an extended string with a character.
-	friend str operator+(const str&, char);
-	// returns this extended string that is the result of concatenating a character array with an extended string.
-	friend str operator+(char, const str&);
+	// Ranges of strings shorter than this are sorted by insertion rather than by distributing them into buckets.
+	static constexpr size_t sort_insertion_threshold = 32;
+	// Ranges of strings shorter than this are sorted by the calling thread only.
+	static constexpr size_t sort_parallel_threshold = 1 << 14;
 
-	/*
-	extracts characters from a given input stream and stores them into this extended string until a given character (a newline character, by default) is encountered (which will not be stored), or until the end-of-file (EOF) is encountered - whichever comes first.
-	the content of this extended string before the call, if any, is replaced.
-	
-	The function returns the input stream from which characters were extracted.
-	*/
-	std::istream& getline(std::istream& input_stream, const char& delim = '\n')
+	// returns the lowercase counterpart of a given character if it is an uppercase letter of the English alphabet, and the character itself otherwise.
+	static unsigned char fold_case(const unsigned char c) noexcept
 	{
-		return std::getline(input_stream, _str, delim);
+		return static_cast<unsigned char>(c + (static_cast<unsigned char>(c - 'A') < 26 ? 'a' - 'A' : 0));
 	}
-	/*
-	extracts characters from a given input stream and stores them into a given extended string until a given character (a newline character, by default) is encountered (which will not be stored), or until the end-of-file (EOF) is encountered - whichever comes first.
 
-	The function returns the input stream from which extraction has occurred.
-	*/
-	static std::istream& getline(std::istream& input_stream, str& str_, const char& delim = '\n')
-	{
-		return std::getline(input_stream, str_._str, delim);
-	}
-	
-	// extracts a character sequence from a given input stream and stores it into a given extended string (replacing its content). Note that extraction stops at the first whitespace character or at the end-of-file (EOF), whichever comes first. The operator returns the input stream from which characters were extracted.			
-	friend std::istream& operator>>(std::istream&, str&);
-	// inserts a copy of the character sequence that is the content of a given extended string into a given output stream. The operator returns the output stream to which characters were inserted.
-	friend std::ostream& operator<<(std::ostream&, const str&);
-	
-	// outputs an STL string followed by a newline to an output stream (the console by default), which is returned. The stream is not flushed by default.
-	static std::ostream& print_line(const std::string& str_, const bool flush = false, std::ostream& output_stream = std::cout)
+	// fills the prefix cache of a given sort entry with (up to) 8 of its characters starting from a given offset.
+	static void load_prefix(sort_entry& entry, const size_t pos, const bool fold) noexcept
 	{
-		output_stream << str_ << (flush ? std::endl : '\n');
+		std::uint64_t prefix = 0;
+		const size_t n = std::min<size_t>(entry.len - pos, 8);
 
-		return output_stream;
+		for (size_t i = 0; i < n; ++i)
+		{
+			const unsigned char c = static_cast<unsigned char>(entry.chars[pos + i]);
+
+			prefix |= static_cast<std::uint64_t>(fold ? fold_case(c) : c) << (56 - 8 * i);
+		}
+
+		entry.prefix = prefix;
+		entry.prefix_pos = pos;
 	}
-	// outputs this extended string to an output stream (the console by default), which is returned. The stream is not flushed by default.
-	std::ostream& print_line(const bool flush = false, std::ostream& output_stream = std::cout) const
+
+	// returns the bucket of a given sort entry at a given depth: zero if the string ends before the said depth, and one plus the value of the character at the said depth otherwise. The prefix cache of the entry is refilled when the depth goes past it.
+	static size_t sort_bucket(sort_entry& entry, const size_t depth, const bool fold) noexcept
 	{
-		output_stream << _str << (flush ? std::endl : '\n');
+		if (depth >= entry.len)
+			return 0;
 
-		return output_stream;
+		if (depth - entry.prefix_pos >= 8)
+			load_prefix(entry, depth, fold);
+
+		return ((entry.prefix >> (56 - 8 * (depth - entry.prefix_pos))) & 0xFF) + 1;
 	}
 
-	// outputs an STL string followed by a newline to a file. The stream is not flushed by default.
-	static void print_line(const std::string& str_, const std::string& file_path, const bool flush = false)
+	// returns the number of characters (up to 8) starting from a given depth shared by all the sort entries of a range, which are known to share the character at the said depth. The prefix caches of the entries are reloaded at the said depth and compared with that of the first entry, so a run of shared characters is skipped 8 characters at a time rather than one character per distribution.
+	static size_t shared_prefix_length(sort_entry* const first, const size_t n, const size_t depth, const bool fold) noexcept
 	{
-		std::fstream file_stream(file_path, std::ios::out);
-		
-		file_stream << str_ << (flush ? std::endl : '\n');
+		size_t shared = 8;
+
+		for (size_t i = 0; i < n && shared > 1; ++i)
+		{
+			sort_entry& entry = first[i];
+
+			if (entry.prefix_pos != depth)
+				load_prefix(entry, depth, fold);
+
+			// the caches are zero-padded past the ends of the strings, so the shared characters are bounded by the lengths as well.
+			shared = std::min(shared, entry.len - depth);
+
+			const std::uint64_t differences = entry.prefix ^ first[0].prefix;
+
+			if (differences != 0)
+				shared = std::min<size_t>(shared, leading_zeros(differences) / 8);
+		}
+
+		return std::max<size_t>(shared, 1);
 	}
-	// outputs this extended string followed by a newline to a file. The stream is not flushed by default.
-	void print_line(const std::string& file_path, const bool flush = false) const
+
+	// returns an integer smaller than, equal to or greater than zero depending on whether the characters of a given sort entry starting from a given depth compare less than, equal to, or greater than those of another.
+	static int compare_from(const sort_entry& entry_l, const sort_entry& entry_r, const size_t depth, const bool fold) noexcept
 	{
-		std::fstream file_stream(file_path, std::ios::out);
-		
-		file_stream << _str << (flush ? std::endl : '\n');
-	}
+		const size_t len = std::min(entry_l.len, entry_r.len);
+
+		for (size_t i = depth; i < len; ++i)
+		{
+			unsigned char c_l = static_cast<unsigned char>(entry_l.chars[i]), c_r = static_cast<unsigned char>(entry_r.chars[i]);
+
+			if (fold)
+			{
+				c_l = fold_case(c_l);
+				c_r = fold_case(c_r);
+			}
+
+			if (c_l != c_r)
+				return (c_l < c_r) ? -1 : 1;
+		}
+
+		return (entry_l.len < entry_r.len) ? -1 : (entry_l.len > entry_r.len);
+	}
+
+	// sorts a range of sort entries whose first (depth) characters are known to be equal, using a most-significant-digit radix sort that distributes the entries into 257 buckets (one for the strings that end before the current depth, and one for each possible character) and then moves to the next depth within each bucket. (buffer) must be as long as the range. If a list of ranges is given, the ranges of fewer than (sort_parallel_threshold) entries are added to it instead of being sorted, so that they can be sorted in parallel, and only the larger ones are distributed.
+	static void radix_sort(sort_entry* entries, sort_entry* buffer, const size_t n, const size_t depth, const bool fold, std::vector<sort_range>* const small_ranges = nullptr)
+	{
+		std::vector<sort_range> tasks = { { 0, n, depth } };
+
+		while (!tasks.empty())
+		{
+			const sort_range task_ = tasks.back();
+			tasks.pop_back();
+
+			if (small_ranges != nullptr && task_.n < sort_parallel_threshold)
+			{
+				small_ranges->push_back(task_);
+
+				continue;
+			}
+
+			sort_entry* const first = entries + task_.begin;
+
+			if (task_.n < sort_insertion_threshold)
+			{
+				for (size_t i = 1; i < task_.n; ++i)
+				{
+					const sort_entry entry = first[i];
+					size_t j = i;
+
+					for (; j > 0 && compare_from(entry, first[j - 1], task_.depth, fold) < 0; --j)
+						first[j] = first[j - 1];
+
+					first[j] = entry;
+				}
+
+				continue;
+			}
+
+			std::array<size_t, 258> offsets = { };
+
+			for (size_t i = 0; i < task_.n; ++i)
+				++offsets[sort_bucket(first[i], task_.depth, fold) + 1];
+
+			for (size_t b = 1; b < offsets.size(); ++b)
+				offsets[b] += offsets[b - 1];
+
+			// all the strings share the character at this depth (a common prefix), so there is nothing to distribute, and the characters they share after it are skipped as well.
+			const size_t first_bucket = sort_bucket(first[0], task_.depth, fold);
+
+			if (offsets[first_bucket + 1] - offsets[first_bucket] == task_.n)
+			{
+				if (first_bucket != 0)
+					tasks.push_back({ task_.begin, task_.n, task_.depth + shared_prefix_length(first, task_.n, task_.depth, fold) });
+
+				continue;
+			}
+
+			std::array<size_t, 258> next = offsets;
+
+			for (size_t i = 0; i < task_.n; ++i)
+				buffer[task_.begin + next[sort_bucket(first[i], task_.depth, fold)]++] = first[i];
+
+			std::copy(buffer + task_.begin, buffer + task_.begin + task_.n, first);
+
+			// bucket 0 holds the strings that have ended, which are all equal to each other.
+			for (size_t b = 1; b < 257; ++b)
+			{
+				const size_t bucket_n = offsets[b + 1] - offsets[b];
+
+				if (bucket_n > 1)
+					tasks.push_back({ task_.begin + offsets[b], bucket_n, task_.depth + 1 });
+			}
+		}
+	}
+
+	// sorts a range of sort entries in natural order, sorting equal-sized chunks of the range in parallel and then merging them pairwise (in parallel as well).
+	static void natural_sort(std::vector<sort_entry>& entries, const bool fold, const size_t n_threads)
+	{
+		const auto less = [fold](const sort_entry& entry_l, const sort_entry& entry_r)
+		{
+			return natural_compare({ entry_l.chars, entry_l.len }, { entry_r.chars, entry_r.len }, !fold) < 0;
+		};
+
+		const size_t n = entries.size();
+		const size_t n_chunks = (n < sort_parallel_threshold) ? 1 : std::max<size_t>(n_threads ? n_threads : std::thread::hardware_concurrency(), 1);
+		const size_t chunk_len = (n + n_chunks - 1) / n_chunks;
+
+		parallel_for(n_chunks, [&](const size_t i)
+		{
+			const size_t begin = std::min(i * chunk_len, n), end = std::min(begin + chunk_len, n);
+
+			std::sort(entries.begin() + begin, entries.begin() + end, less);
+		}, n_threads);
+
+		for (size_t width = chunk_len; width < n; width *= 2)
+		{
+			const size_t n_merges = (n + 2 * width - 1) / (2 * width);
+
+			parallel_for(n_merges, [&](const size_t i)
+			{
+				const size_t begin = i * 2 * width, middle = std::min(begin + width, n), end = std::min(begin + 2 * width, n);
+
+				std::inplace_merge(entries.begin() + begin, entries.begin() + middle, entries.begin() + end, less);
+			}, n_threads);
+		}
+	}
+
+public:
+	/*
+	sorts a range of extended strings, STL strings, string views or character arrays (defined by a pair of random access iterators) in a given order (by default, lexicographic order, which is case-sensitive).
+
+	the strings are not compared to each other directly. Instead, they are sorted by a multi-threaded most-significant-digit radix sort that works on an array holding a cache of 8 characters of each string, so that the characters are read with no indirection, and a prefix shared by all the strings of a bucket is skipped 8 characters at a time (by comparing their caches) rather than distributed one character at a time. The natural order, in which runs of digits are compared by their numeric values, is not suited to radix sorting, so it is performed as a parallel merge sort instead. Like the case-insensitive order, the natural order ignores the case of letters.
+
+	the calling thread distributes the strings into buckets, and the buckets of at least 16K strings further (skipping the prefixes their strings share), until the buckets are smaller than that, and the buckets are then sorted in parallel, largest first. This way, strings that all share a first character or a longer prefix (such as URLs, or keys of a common namespace) are sorted in parallel as well. By default, the number of threads is the number of hardware threads, and small ranges are sorted by the calling thread only. The order of strings that are equal (or equal when their case is ignored) is unspecified.
+	*/
+	template<class Iter> static void sort(Iter first, Iter last, const sort_order order = lexicographic, const size_t n_threads = 0)
+	{
+		using value_type = typename std::iterator_traits<Iter>::value_type;
+
+		const size_t n = static_cast<size_t>(last - first);
+
+		if (n < 2)
+			return;
+
+		const bool fold = (order != lexicographic);
+
+		std::vector<sort_entry> entries = {};
+		entries.reserve(n);
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			const std::string_view view = view_of(first[i]);
+
+			sort_entry entry = { 0, 0, view.data(), view.length(), i };
+			load_prefix(entry, 0, fold);
+
+			entries.push_back(entry);
+		}
+
+		if (order == natural)
+			natural_sort(entries, fold, n_threads);
+		else
+		{
+			std::vector<sort_entry> buffer(n);
+
+			if (n < sort_parallel_threshold)
+				radix_sort(entries.data(), buffer.data(), n, 0, fold);
+			else
+			{
+				// distributes the strings on the calling thread until the buckets are small, then sorts the buckets in parallel, largest first.
+				std::vector<sort_range> ranges = {};
+
+				radix_sort(entries.data(), buffer.data(), n, 0, fold, &ranges);
+
+				std::sort(ranges.begin(), ranges.end(), [](const sort_range& range_l, const sort_range& range_r)
+				{
+					return range_l.n > range_r.n;
+				});
+
+				parallel_for(ranges.size(), [&](const size_t i)
+				{
+					const sort_range& range = ranges[i];
+
+					radix_sort(entries.data() + range.begin, buffer.data() + range.begin, range.n, range.depth, fold);
+				}, n_threads);
+			}
+		}
+
+		std::vector<value_type> sorted = {};
+		sorted.reserve(n);
+
+		for (const sort_entry& entry : entries)
+			sorted.push_back(std::move(first[entry.index]));
+
+		std::move(sorted.begin(), sorted.end(), first);
+	}
+	// sorts a C++ STL container of extended strings, STL strings, string views or character arrays in a given order (by default, lexicographic order, which is case-sensitive). See the iterator version of (sort) for details.
+	template<class Cont> static void sort(Cont& strs, const sort_order order = lexicographic, const size_t n_threads = 0)
+	{
+		sort(std::begin(strs), std::end(strs), order, n_threads);
+	}
+
+	// An operation of a batch transformation, which transforms a given string in place (for example, a lambda assigning it its (trim_view), or calling (normalize_whitespace_in_place) on it), so that the string can be reused from one input to the next.
+	using batch_operation = std::function<void(std::string&)>;
+
+	// The strings resulting from a batch transformation, in the order of the input. Each chunk of the input is transformed by a single thread, which stores the resulting strings contiguously in the arena of the chunk.
+	class batch_result
+	{
+		struct chunk
+		{
+			std::string chars;
+			std::vector<size_t> ends;
+		};
+
+		std::vector<chunk> chunks = {};
+		size_t chunk_size = 1;
+		size_t n = 0;
+
+		friend class str;
+
+	public:
+		// returns the number of strings.
+		size_t size() const noexcept
+		{
+			return n;
+		}
+		// returns whether there are no strings.
+		bool empty() const noexcept
+		{
+			return n == 0;
+		}
+
+		// returns a view of the string at a given index, which is valid as long as this result exists.
+		std::string_view operator[](const size_t i) const noexcept
+		{
+			const chunk& chunk_ = chunks[i / chunk_size];
+			const size_t j = i % chunk_size, begin = (j == 0) ? 0 : chunk_.ends[j - 1];
+
+			return { chunk_.chars.data() + begin, chunk_.ends[j] - begin };
+		}
+
+		// returns copies of the strings as a vector of extended strings.
+		std::vector<str> strs() const
+		{
+			std::vector<str> strs_ = { };
+			strs_.reserve(n);
+
+			for (size_t i = 0; i < n; ++i)
+				strs_.emplace_back(std::string((*this)[i]));
+
+			return strs_;
+		}
+	};
+
+	/*
+	applies given operations, in order, to each string in the range [first, last) of extended strings, STL strings, string views or character arrays, and returns the resulting strings in the order of the input.
+
+	the range is split into chunks of 4096 strings, which are transformed in parallel on the shared thread pool by a given number of threads (by default, every worker of the pool and the calling thread). Each chunk is transformed input by input in a scratch string of its own, whose capacity is reused from one input to the next, and the results are appended to the arena of the chunk, so no string is allocated per result (unless an operation allocates by itself). The scratch string belongs to the chunk rather than to the thread, so an operation may run a parallel algorithm itself: the thread waiting for it may transform another chunk of the same batch meanwhile.
+	*/
+	template<class Iter> static batch_result batch(Iter first, Iter last, const std::vector<batch_operation>& operations, const size_t n_threads = 0)
+	{
+		constexpr size_t chunk_size = 4096;
+
+		batch_result result = {};
+		result.n = static_cast<size_t>(std::distance(first, last));
+		result.chunk_size = chunk_size;
+		result.chunks.resize((result.n + chunk_size - 1) / chunk_size);
+
+		parallel_for(result.chunks.size(), [&](const size_t c)
+		{
+			batch_result::chunk& chunk_ = result.chunks[c];
+			const size_t n = std::min(chunk_size, result.n - c * chunk_size);
+			Iter it = std::next(first, static_cast<std::ptrdiff_t>(c * chunk_size));
+			std::string scratch = {};
+
+			chunk_.ends.reserve(n);
+
+			for (size_t i = 0; i < n; ++i, ++it)
+			{
+				scratch.assign(view_of(*it));
+
+				for (const batch_operation& operation : operations)
+					operation(scratch);
+
+				chunk_.chars += scratch;
+				chunk_.ends.push_back(chunk_.chars.length());
+			}
+		}, n_threads);
+
+		return result;
+	}
+	// applies given operations, in order, to each string of a C++ STL container of extended strings, STL strings, string views or character arrays, and returns the resulting strings in the order of the container. See the iterator version of (batch) for details.
+	template<class Cont> static batch_result batch(const Cont& strs, const std::vector<batch_operation>& operations, const size_t n_threads = 0)
+	{
+		return batch(std::begin(strs), std::end(strs), operations, n_threads);
+	}
+#if defined(STR_EXECUTION)
+	// applies given operations, in order, to each string in the range [first, last), with a given execution policy: sequentially for the sequenced policy, and in parallel on the shared thread pool for the others. See the other iterator version of (batch) for details.
+	template<class ExecutionPolicy, class Iter, std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0> static batch_result batch(ExecutionPolicy&&, Iter first, Iter last, const std::vector<batch_operation>& operations)
+	{
+		return batch(first, last, operations, std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy> ? 1 : 0);
+	}
+#endif
+
+	// The character encodings that the case mapping and classification functions can assume. By default, each character (byte) is treated on its own, as the functions of the C standard library do. In UTF-8 mode, multibyte sequences are decoded and treated as a whole, and invalid sequences are left untouched.
+	enum char_encoding : std::int8_t { ascii = 0, utf8 = 1 };
+
+private:
+	// The case mappings that can be applied to the letters of a character sequence.
+	enum case_mapping : std::int8_t { to_upper_case, to_lower_case, to_opposite_case };
+
+	// returns a given STL string with the first character of each substring delimited by the delimiters of a given set replaced by its uppercase or lowercase counterpart.
+	template<class Delims> static std::string map_initials(const std::string& str_, const Delims& delims, const case_mapping mapping)
+	{
+		std::string str_mapped = str_;
+
+		for_each_word(str_.data(), str_.data() + str_.length(), delims, [&](const char* first, const char*)
+		{
+			const unsigned char initial = static_cast<unsigned char>(*first);
+
+			str_mapped[static_cast<size_t>(first - str_.data())] = static_cast<char>((mapping == to_upper_case) ? std::toupper(initial) : std::tolower(initial));
+		});
+
+		return str_mapped;
+	}
+	// returns the result of applying a case mapping to a given Unicode code point.
+	static char32_t map_case(const char32_t cp, const case_mapping mapping) noexcept
+	{
+		switch (mapping)
+		{
+		case to_upper_case:
+			return upper_case(cp);
+		case to_lower_case:
+			return lower_case(cp);
+		case to_opposite_case:
+			return opposite_case(cp);
+		}
+
+		return cp;
+	}
+
+	// applies a case mapping to the English letters of a given array of ASCII characters of a given length, writing the result into another array (which can be the same array), 16 characters at a time where vector instructions are available.
+	static void map_ascii_case(const char* chars, const size_t len, char* out, const case_mapping mapping) noexcept
+	{
+		size_t i = 0;
+
+#if defined(STR_SSE2)
+		// moves each range of letters to the bottom of the signed range, so that a single signed comparison tests for it.
+		const __m128i shift_u = _mm_set1_epi8(static_cast<char>(0x80 - 'A')), shift_l = _mm_set1_epi8(static_cast<char>(0x80 - 'a'));
+		const __m128i limit = _mm_set1_epi8(static_cast<char>(-128 + 26)), case_bit = _mm_set1_epi8(0x20);
+
+		for (; i + 16 <= len; i += 16)
+		{
+			const __m128i chars_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+			const __m128i is_upper = _mm_cmplt_epi8(_mm_add_epi8(chars_, shift_u), limit);
+			const __m128i is_lower = _mm_cmplt_epi8(_mm_add_epi8(chars_, shift_l), limit);
+
+			const __m128i flip = (mapping == to_upper_case) ? is_lower : ((mapping == to_lower_case) ? is_upper : _mm_or_si128(is_upper, is_lower));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(chars_, _mm_and_si128(flip, case_bit)));
+		}
+#endif
+		for (; i < len; ++i)
+		{
+			const unsigned char c = static_cast<unsigned char>(chars[i]);
+			const bool is_upper = static_cast<unsigned char>(c - 'A') < 26, is_lower = static_cast<unsigned char>(c - 'a') < 26;
+
+			const bool flip = (mapping == to_upper_case) ? is_lower : ((mapping == to_lower_case) ? is_upper : (is_upper || is_lower));
+
+			out[i] = static_cast<char>(flip ? (c ^ 0x20) : c);
+		}
+	}
+
+	// returns an STL string equivalent to a given UTF-8 string with a case mapping applied to each of its letters. Runs of ASCII characters are detected with vector instructions and mapped in bulk, and invalid sequences are copied unchanged.
+	static std::string map_utf8_case(const std::string& str_, const case_mapping mapping)
+	{
+		std::string str_m = {};
+		str_m.reserve(str_.length());
+
+		const char* pos = str_.data();
+		const char* const end = pos + str_.length();
+
+		while (pos != end)
+		{
+			const size_t ascii_len = ascii_prefix_length(pos, static_cast<size_t>(end - pos));
+
+			if (ascii_len != 0)
+			{
+				const size_t off = str_m.length();
+
+				str_m.resize(off + ascii_len);
+				map_ascii_case(pos, ascii_len, &str_m[off], mapping);
+
+				pos += ascii_len;
+
+				continue;
+			}
+
+			char32_t cp = 0;
+			const size_t cp_len = utf8_decode(pos, end, cp);
+
+			if (cp_len == 0)
+			{
+				str_m.push_back(*pos++);
+
+				continue;
+			}
+
+			char encoded[4];
+			str_m.append(encoded, utf8_encode(map_case(cp, mapping), encoded));
+
+			pos += cp_len;
+		}
+
+		return str_m;
+	}
+
+	// returns an STL string equivalent to a given UTF-8 string with a case mapping applied to the first letter of each substring delimited by a given set of (ASCII) delimiters. Runs of ASCII characters are detected with vector instructions and copied at once, and only their initials are mapped, found by skipping from one delimiter to the next with vector compares.
+	static std::string map_utf8_initials(const std::string& str_, const std::string& delims, const case_mapping mapping)
+	{
+		std::string str_m = {};
+		str_m.reserve(str_.length());
+
+		const dynamic_delimiter_set delims_(delims);
+		const char* pos = str_.data();
+		const char* const end = pos + str_.length();
+
+		bool is_initial = true;
+
+		while (pos != end)
+		{
+			const size_t ascii_len = ascii_prefix_length(pos, static_cast<size_t>(end - pos));
+
+			if (ascii_len != 0)
+			{
+				const char* const run_end = pos + ascii_len;
+				const size_t off = str_m.length();
+
+				str_m.append(pos, ascii_len);
+
+				for (const char* c = pos; c != run_end;)
+				{
+					c = is_initial ? find_delim<false>(c, run_end, delims_) : find_delim<true>(c, run_end, delims_);
+
+					if (c == run_end)
+						break;
+
+					if (is_initial)
+					{
+						map_ascii_case(c, 1, &str_m[off + static_cast<size_t>(c - pos)], mapping);
+						++c;
+					}
+
+					is_initial = !is_initial;
+				}
+
+				pos = run_end;
+
+				continue;
+			}
+
+			char32_t cp = 0;
+			const size_t cp_len = utf8_decode(pos, end, cp);
+
+			if (cp_len == 0)
+			{
+				str_m.push_back(*pos++);
+				is_initial = false;
+
+				continue;
+			}
+
+			// (a code point beyond the ASCII range is never a delimiter.)
+			if (is_initial)
+			{
+				char encoded[4];
+				str_m.append(encoded, utf8_encode(map_case(cp, mapping), encoded));
+			}
+			else
+				str_m.append(pos, cp_len);
+
+			is_initial = false;
+			pos += cp_len;
+		}
+
+		return str_m;
+	}
+
+public:
+	// returns the STL string whose characters are the uppercase counterparts of another given STL string. In UTF-8 mode, the letters beyond the ASCII range are mapped as well.
+	static std::string to_upper(const std::string& str_, const char_encoding encoding = ascii)
+	{
+		if (encoding == utf8)
+			return map_utf8_case(str_, to_upper_case);
+
+		std::string str_u = std::string();
+
+		for (const char& c : str_)
+			str_u.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+
+		return str_u;
+	}
+	// returns the STL string whose characters are the lowercase counterparts of another given STL string. In UTF-8 mode, the letters beyond the ASCII range are mapped as well.
+	static std::string to_lower(const std::string& str_, const char_encoding encoding = ascii)
+	{
+		if (encoding == utf8)
+			return map_utf8_case(str_, to_lower_case);
+
+		std::string str_l = std::string();
+
+		for (const char& c : str_)
+			str_l.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+
+		return str_l;
+	}
+	// returns the STL string whose characters are the opposite case counterparts of another given STL string. In UTF-8 mode, the letters beyond the ASCII range are mapped as well.
+	static std::string swap_case(const std::string& str_, const char_encoding encoding = ascii)
+	{
+		if (encoding == utf8)
+			return map_utf8_case(str_, to_opposite_case);
+
+		std::string str_s = std::string();
+
+		for (const char& c : str_)
+			str_s.push_back(opposite_case(c));
+
+		return str_s;
+	}
+	
+	// returns a capitalized version of a given STL string (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
+	static std::string capitalize_front(const std::string& str_, const bool to_lower_rest = true)
+	{
+		const size_t len = str_.length();
+
+		std::string str_cap = std::string();
+		str_cap.reserve(len);
+
+		str_cap.push_back(std::toupper(str_.front()));
+
+		for (size_t i = 1; i < len; i++)
+			str_cap.push_back(to_lower_rest ? std::tolower(str_.at(i)) : str_.at(i));
+
+		return str_cap;
+	}
+	// returns a capitalized version of a given STL string (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
+	static std::string cap_f(const std::string& str_, const bool to_lower_rest = true)
+	{
+		const size_t len = str_.length();
+
+		std::string str_cap = std::string();
+		str_cap.reserve(len);
+
+		str_cap.push_back(std::toupper(str_.front()));
+
+		for (size_t i = 1; i < len; i++)
+			str_cap.push_back(to_lower_rest ? std::tolower(str_.at(i)) : str_.at(i));
+
+		return str_cap;
+	}
+	
+	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
+	static std::string uncapitalize_front(const std::string& str_, const bool to_upper_rest = true)
+	{
+		const size_t len = str_.length();
+
+		std::string str_cap = std::string();
+		str_cap.reserve(len);
+
+		str_cap.push_back(std::tolower(str_.front()));
+
+		for (size_t i = 1; i < len; i++)
+			str_cap.push_back(to_upper_rest ? std::toupper(str_.at(i)) : str_.at(i));
+
+		return str_cap;
+	}
+	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
+	static std::string uncap_f(const std::string& str_, const bool to_upper_rest = true)
+	{
+		const size_t len = str_.length();
+
+		std::string str_cap = std::string();
+		str_cap.reserve(len);
+
+		str_cap.push_back(std::tolower(str_.front()));
+
+		for (size_t i = 1; i < len; i++)
+			str_cap.push_back(to_upper_rest ? std::toupper(str_.at(i)) : str_.at(i));
+
+		return str_cap;
+	}
+
+	// returns this extended string whose characters are the uppercase counterparts of this extended string. In UTF-8 mode, the letters beyond the ASCII range are mapped as well.
+	str to_upper(const char_encoding encoding = ascii) const
+	{
+		return to_upper(_str, encoding);
+	}
+	// returns this extended string whose characters are the lowercase counterparts of this extended string. In UTF-8 mode, the letters beyond the ASCII range are mapped as well.
+	str to_lower(const char_encoding encoding = ascii) const
+	{
+		return to_lower(_str, encoding);
+	}
+	// returns this extended string whose characters are the opposite case counterparts of this extended string. In UTF-8 mode, the letters beyond the ASCII range are mapped as well.
+	str swap_case(const char_encoding encoding = ascii) const
+	{
+		return swap_case(_str, encoding);
+	}
+	// returns a capitalized version of this extended string. (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
+	str capitalize_front(const bool to_lower_rest = true) const
+	{
+		return capitalize_front(_str, to_lower_rest);
+	}
+	// returns a capitalized version of this extended string. (has the same character sequence, with the first character replaced by its uppercase counterpart and, by default, the rest of the characters are replaced by their lowercase counterparts).
+	str cap_f(const bool to_lower_rest = true) const
+	{
+		return cap_f(_str, to_lower_rest);
+	}
+	
+	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
+	str uncapitalize_front(const bool to_upper_rest = true) const
+	{
+		return uncapitalize_front(_str, to_upper_rest);
+	}
+	// returns an uncapitalized version of a given STL string (has the same character sequence, with the first character replaced by its lowercase counterpart and, by default, the rest of the characters are replaced by their uppercase counterparts).
+	str uncap_f(const bool to_upper_rest = true) const
+	{
+		return uncap_f(_str, to_upper_rest);
+	}
+	
+	// returns the count of uppercase alphabetical characters (capital letters) in a given STL string.
+	static size_t uppercase_count(const std::string& str_)
+	{
+		return std::count_if(str_.begin(), str_.end(), isupper);
+	}
+	// returns the count of lowercase alphabetical characters (small letters) in a given STL string.
+	static size_t lowercase_count(const std::string& str_)
+	{
+		return std::count_if(str_.begin(), str_.end(), islower);
+	}
+	
+	// returns the count of uppercase alphabetical characters (capital letters) in this extended string.
+	size_t uppercase_count()
+	{
+		return std::count_if(_str.begin(), _str.end(), isupper);
+	}
+	// returns the count of lowercase alphabetical characters (capital letters) in this extended string.
+	size_t lowercase_count()
+	{
+		return std::count_if(_str.begin(), _str.end(), islower);
+	}
+	
+	// returns the count of characters representing English vowels in a given STL string. By default, the letter (y) is not considered a vowel. In UTF-8 mode, vowels with diacritics (such as é and ö) are counted as well.
+	static size_t vowel_count(const std::string& str_, const bool include_y = false, const char_encoding encoding = ascii)
+	{
+		// TODO: use C++ STL algorithm function.
+
+		size_t count = 0;
+
+		if (encoding == utf8)
+			return count_utf8_vowels(str_.data(), str_.data() + str_.length(), str_.data() + str_.length(), include_y);
+
+		for (const char& c : str_)
+		{
+			if (is_vowel(c, include_y))
+				count++;
+		}
+
+		return count;
+	}
+	// returns the count of characters representing English consonants in a given STL string. By default, the letter (y) is not considered a vowel.
+	static size_t consonant_count(const std::string& str_, const bool is_y_vowel = false)
+	{
+		return (str_.length() - vowel_count(str_, is_y_vowel));
+	}
+
+	// returns the count of characters representing English vowels in this extended string. In UTF-8 mode, vowels with diacritics (such as é and ö) are counted as well.
+	size_t vowel_count(const bool include_y = false, const char_encoding encoding = ascii) const
+	{
+		return vowel_count(_str, include_y, encoding);
+	}
+	// returns the count of characters representing English vowels in of this extended string.
+	size_t consonant_count(const bool is_y_vowel = false) const
+	{
+		return consonant_count(_str, is_y_vowel);
+	}
+
+	// returns the count of a given character in a given STL string. Counting is case-sensitive by default.
+	static size_t count(const std::string& str_, const char c, const bool case_sensitive = true)
+	{
+		const size_t count_cs = std::count(str_.begin(), str_.end(), c);
+
+		if (case_sensitive)
+			return count_cs;
+		
+		const char _c = opposite_case(c);
+
+		return (count_cs + std::count(str_.begin(), str_.end(), _c));
+	}
+	// returns the count of a given character in this extended string. Counting is case-sensitive by default.
+	size_t count(const char c, const bool case_sensitive = true) const
+	{
+		return count(_str, c, case_sensitive);
+	}
+	
+	// The possible space-trimming operations that can be performed on a character sequence.
+	enum trim_operation : std::int8_t { left = -1, all = 0, right = +1 };
+
+private:
+	// returns whether a given character is one of the whitespaces.
+	static constexpr bool is_whitespace(const char c) noexcept
+	{
+		return c == ' ' || (c >= '\t' && c <= '\r');
+	}
+
+	// The whitespaces, as a delimiter set whose vector test is a range compare (for the characters from '\t' to '\r') and a compare with the space.
+	struct whitespace_set
+	{
+		// returns whether a given character is a whitespace.
+		static constexpr bool contains(const char c) noexcept
+		{
+			return is_whitespace(c);
+		}
+		static constexpr bool is_single() noexcept
+		{
+			return false;
+		}
+		static constexpr bool is_vectorized() noexcept
+		{
+			return true;
+		}
+		static constexpr char first() noexcept
+		{
+			return ' ';
+		}
+
+#if defined(STR_AVX2)
+		// returns a mask of the characters of a given block which are whitespaces.
+		static __m256i match(const __m256i block) noexcept
+		{
+			const __m256i distance = _mm256_sub_epi8(block, _mm256_set1_epi8('\t'));
+
+			return _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(distance, _mm256_set1_epi8('\r' - '\t')), distance), _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')));
+		}
+#endif
+#if defined(STR_SSE2)
+		// returns a mask of the characters of a given block which are whitespaces.
+		static __m128i match(const __m128i block) noexcept
+		{
+			const __m128i distance = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+
+			return _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(distance, _mm_set1_epi8('\r' - '\t')), distance), _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')));
+		}
+#endif
+	};
+
+	// returns the offsets of the first and after-the-last characters of given characters that are left by a given trimming operation removing the characters of a given set. The characters are scanned inward from the trimmed ends with vector tests of the set, 32 or 16 at a time.
+	template<class Chars> static std::pair<size_t, size_t> trim_bounds(const std::string_view str_, const trim_operation trim_op, const Chars& chars) noexcept
+	{
+		const char* const begin = str_.data();
+		const char* first = begin;
+		const char* last = begin + str_.length();
+
+		if (trim_op != right)
+			first = find_delim<false>(first, last, chars);
+		if (trim_op != left)
+			last = rfind_delim<false>(first, last, chars);
+
+		return { static_cast<size_t>(first - begin), static_cast<size_t>(last - begin) };
+	}
+
+public:
+	// returns the offsets of the first and after-the-last characters of a given STL string (or string view) that are left by trimming its leading, trailing or both leading and trailing (the default) whitespaces, without copying any character.
+	static std::pair<size_t, size_t> trim_bounds(const std::string_view str_, const trim_operation trim_op = all) noexcept
+	{
+		return trim_bounds(str_, trim_op, whitespace_set());
+	}
+	// returns the offsets of the first and after-the-last characters of a given STL string (or string view) that are left by trimming the leading, trailing or both leading and trailing characters that are in a given set.
+	static std::pair<size_t, size_t> trim_bounds(const std::string_view str_, const trim_operation trim_op, const std::string_view chars) noexcept
+	{
+		return trim_bounds(str_, trim_op, dynamic_delimiter_set(chars));
+	}
+
+	// returns a view of a given STL string (or string view) without its leading, trailing or both leading and trailing (the default) whitespaces, without copying any character. See (trim_bounds).
+	static std::string_view trim_view(const std::string_view str_, const trim_operation trim_op = all) noexcept
+	{
+		const auto [first, last] = trim_bounds(str_, trim_op);
+
+		return str_.substr(first, last - first);
+	}
+	// returns a view of a given STL string (or string view) without its leading, trailing or both leading and trailing characters that are in a given set.
+	static std::string_view trim_view(const std::string_view str_, const trim_operation trim_op, const std::string_view chars) noexcept
+	{
+		const auto [first, last] = trim_bounds(str_, trim_op, chars);
+
+		return str_.substr(first, last - first);
+	}
+	// returns a view of this extended string without its leading, trailing or both leading and trailing (the default) whitespaces. The view is invalidated by any change to this extended string.
+	std::string_view trim_view(const trim_operation trim_op = all) const noexcept
+	{
+		return trim_view(std::string_view(_str), trim_op);
+	}
+
+	// returns views of the strings of a C++ STL container of extended strings, STL strings or string views (such as a column of fields) without their leading, trailing or both leading and trailing (the default) whitespaces, in the order of the container. The strings must outlive the views.
+	template<class Cont> static std::vector<std::string_view> trim_views(const Cont& strs, const trim_operation trim_op = all)
+	{
+		std::vector<std::string_view> views = {};
+		views.reserve(static_cast<size_t>(std::distance(std::begin(strs), std::end(strs))));
+
+		for (const auto& str_ : strs)
+			views.push_back(trim_view(view_of(str_), trim_op));
+
+		return views;
+	}
+	// trims the leading, trailing or both leading and trailing (the default) whitespaces of each of given views (such as the fields of a record returned by a CSV reader) in place.
+	static void trim_each(std::vector<std::string_view>& views, const trim_operation trim_op = all) noexcept
+	{
+		for (std::string_view& view : views)
+			view = trim_view(view, trim_op);
+	}
+
+	// returns the STL string that is equivalent to another given STL string without the leading whitespaces (if any). (returns the left-trimmed version of a given STL string). A set of characters other than whitespaces can also be chosen for removal.
+	static std::string l_trim(const std::string& str_, const std::string& chars = whitespaces)
+	{
+		return std::string(trim_view(str_, left, chars));
+	}
+	// returns the STL string that is equivalent to another given STL string without the leading whitespaces (if any). (returns the left-trimmed version of a given STL string).
+	static std::string trim_leading_spaces(const std::string& str_)
+	{
+		return std::string(trim_view(str_, left));
+	}
+
+	// returns the STL string that is equivalent to a given STL string without the trailing spaces (if any). (returns the right-trimmed version of a given STL string). A set of characters other than whitespaces can also be chosen for removal.
+	static std::string r_trim(const std::string& str_, const std::string& chars = whitespaces)
+	{
+		return std::string(trim_view(str_, right, chars));
+	}
+	// returns the STL string that is equivalent to a given STL string without the trailing spaces (if any). (returns the right-trimmed version of a given STL string).
+	static std::string trim_trailing_spaces(const std::string& str_)
+	{
+		return std::string(trim_view(str_, right));
+	}
+
+	// returns the STL string that is equivalent to a given STL string without the leading, trailing or both leading and trailing spaces (the default) (if any). A set of characters other than whitespaces can also be chosen for removal. The trimmed characters are found in place (see (trim_view)), so a single string is allocated.
+	static std::string trim(const std::string& str_, const trim_operation trim_op = all, const std::string& chars = whitespaces)
+	{
+		return std::string(trim_view(str_, trim_op, chars));
+	}
+	// returns the STL string that is equivalent to a given STL string without the leading, trailing or both leading and trailing spaces (the default) (if any).
+	static std::string trim_spaces(const std::string& str_)
+	{
+		return trim(str_, all);
+	}
+	
+	// returns the extended string that is equivalent to this one without the leading spaces (if any). (returns the left-trimmed version of this extended string). A set of characters other than whitespaces can also be chosen for removal.
+	str l_trim(const std::string& chars = whitespaces) const
+	{
+		return l_trim(_str, chars);
+	}
+	// returns this extended string that is equivalent to this one without the leading spaces (if any). (returns the left-trimmed version of this extended string).
+	str trim_leading_spaces() const
+	{
+		return trim_leading_spaces(_str);
+	}
+
+	// returns the extended string that is equivalent to this one without the trailing spaces (if any). (returns the right-trimmed version of this extended string). A set of characters other than whitespaces can also be chosen for removal.
+	str r_trim(const std::string& chars = whitespaces) const
+	{
+		return r_trim(_str, chars);
+	}
+	// returns this extended string that is equivalent to this one without the trailing spaces (if any). (returns the right-trimmed version of this extended string).
+	str trim_trailing_spaces() const
+	{
+		return trim_trailing_spaces(_str);
+	}
+
+	// returns the extended string that is equivalent to this one without the leading, trailing or both leading and trailing spaces (the default) (if any). A set of characters other than whitespaces can also be chosen for removal.
+	str trim(const trim_operation trim_op = all, const std::string& chars = whitespaces) const
+	{
+		return trim(_str, trim_op, chars);
+	}
+	// returns this extended string that is equivalent to this one without the leading, trailing or both leading and trailing spaces (the default) (if any).
+	str trim_spaces(const trim_operation trim_op = all) const
+	{
+		return trim(_str, trim_op);
+	}
+
+	/*
+	A class of characters (any set of the 256 byte values), such as the punctuation marks or the digits, used by the character filters of this library (see (remove_if) and (keep_if)).
+
+	the class is a 256-bit set laid out for vector lookups: the character c is bit (c >> 4) & 7 of row (c >> 7) * 16 + (c & 15), so a block of characters is tested with two 16-byte table lookups (on the low nibbles) and a compare. The ASCII classes match the "C" locale classification of <cctype>, and no character beyond the ASCII range is in them.
+	*/
+	class char_class
+	{
+		std::array<std::uint8_t, 32> rows = { };
+
+		// returns the row and the bit of a given character.
+		static constexpr size_t row_of(const char c) noexcept
+		{
+			return static_cast<size_t>((static_cast<unsigned char>(c) >> 7) * 16 + (static_cast<unsigned char>(c) & 15));
+		}
+		static constexpr std::uint8_t bit_of(const char c) noexcept
+		{
+			return static_cast<std::uint8_t>(1u << ((static_cast<unsigned char>(c) >> 4) & 7));
+		}
+
+		friend class str;
+
+	public:
+		// constructs an empty class.
+		constexpr char_class() noexcept = default;
+		// constructs the class of the characters of a given STL string (or string view).
+		constexpr explicit char_class(const std::string_view chars) noexcept
+		{
+			for (const char c : chars)
+				insert(c);
+		}
+
+		// returns the class of the characters from a given character to another (both included).
+		static constexpr char_class range(const char first, const char last) noexcept
+		{
+			char_class class_ = {};
+
+			for (unsigned c = static_cast<unsigned char>(first); c <= static_cast<unsigned char>(last); ++c)
+				class_.insert(static_cast<char>(c));
+
+			return class_;
+		}
+		// returns the class of the decimal digits.
+		static constexpr char_class digits() noexcept
+		{
+			return range('0', '9');
+		}
+		// returns the class of the uppercase letters.
+		static constexpr char_class uppers() noexcept
+		{
+			return range('A', 'Z');
+		}
+		// returns the class of the lowercase letters.
+		static constexpr char_class lowers() noexcept
+		{
+			return range('a', 'z');
+		}
+		// returns the class of the letters.
+		static constexpr char_class alphas() noexcept
+		{
+			return uppers() | lowers();
+		}
+		// returns the class of the letters and the decimal digits.
+		static constexpr char_class alnums() noexcept
+		{
+			return alphas() | digits();
+		}
+		// returns the class of the whitespaces.
+		static constexpr char_class spaces() noexcept
+		{
+			return range('\t', '\r') | char_class(" ");
+		}
+		// returns the class of the punctuation marks.
+		static constexpr char_class puncts() noexcept
+		{
+			return range('!', '/') | range(':', '@') | range('[', '`') | range('{', '~');
+		}
+		// returns the class of the control characters.
+		static constexpr char_class controls() noexcept
+		{
+			return range('\0', '\x1F') | char_class("\x7F");
+		}
+		// returns the class of the printable characters (the space included).
+		static constexpr char_class printables() noexcept
+		{
+			return range(' ', '~');
+		}
+		// returns the class of the ASCII characters.
+		static constexpr char_class ascii() noexcept
+		{
+			return range('\0', '\x7F');
+		}
+
+		// adds a given character to this class.
+		constexpr char_class& insert(const char c) noexcept
+		{
+			rows[row_of(c)] |= bit_of(c);
+
+			return *this;
+		}
+		// returns whether a given character is in this class.
+		constexpr bool contains(const char c) const noexcept
+		{
+			return (rows[row_of(c)] & bit_of(c)) != 0;
+		}
+		// returns whether this class has no characters.
+		constexpr bool empty() const noexcept
+		{
+			for (const std::uint8_t row : rows)
+				if (row != 0)
+					return false;
+
+			return true;
+		}
+
+		// returns the union, the intersection or the difference of this class and another, or the complement of this class.
+		constexpr char_class operator|(const char_class& other) const noexcept
+		{
+			char_class class_ = *this;
+
+			for (size_t i = 0; i < rows.size(); ++i)
+				class_.rows[i] |= other.rows[i];
+
+			return class_;
+		}
+		constexpr char_class operator&(const char_class& other) const noexcept
+		{
+			char_class class_ = *this;
+
+			for (size_t i = 0; i < rows.size(); ++i)
+				class_.rows[i] &= other.rows[i];
+
+			return class_;
+		}
+		constexpr char_class operator-(const char_class& other) const noexcept
+		{
+			return *this & ~other;
+		}
+		constexpr char_class operator~() const noexcept
+		{
+			char_class class_ = *this;
+
+			for (std::uint8_t& row : class_.rows)
+				row = static_cast<std::uint8_t>(~row);
+
+			return class_;
+		}
+
+		// returns whether this class and another have the same characters.
+		constexpr bool operator==(const char_class& other) const noexcept
+		{
+			for (size_t i = 0; i < rows.size(); ++i)
+				if (rows[i] != other.rows[i])
+					return false;
+
+			return true;
+		}
+		constexpr bool operator!=(const char_class& other) const noexcept
+		{
+			return !(*this == other);
+		}
+	};
+
+private:
+#if defined(STR_SSSE3)
+	// returns a mask of the characters of a given block which are in a class, given the rows of the class for the characters below and above 0x80.
+	static __m128i match_class(const __m128i block, const __m128i low_rows, const __m128i high_rows) noexcept
+	{
+		const __m128i bits = _mm_set1_epi64x(0x8040201008040201);
+		const __m128i bit = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(block, 4), _mm_set1_epi8(15)));
+		const __m128i row = _mm_or_si128(_mm_shuffle_epi8(low_rows, block), _mm_shuffle_epi8(high_rows, _mm_xor_si128(block, _mm_set1_epi8(-128))));
+
+		return _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit);
+	}
+#endif
+#if defined(STR_AVX2)
+	static __m256i match_class(const __m256i block, const __m256i low_rows, const __m256i high_rows) noexcept
+	{
+		const __m256i bits = _mm256_set1_epi64x(0x8040201008040201);
+		const __m256i bit = _mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(block, 4), _mm256_set1_epi8(15)));
+		const __m256i row = _mm256_or_si256(_mm256_shuffle_epi8(low_rows, block), _mm256_shuffle_epi8(high_rows, _mm256_xor_si256(block, _mm256_set1_epi8(-128))));
+
+		return _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+	}
+#endif
+#if defined(STR_AVX512)
+	static std::uint64_t match_class(const __m512i block, const __m512i low_rows, const __m512i high_rows) noexcept
+	{
+		const __m512i bits = _mm512_set1_epi64(0x8040201008040201);
+		const __m512i bit = _mm512_shuffle_epi8(bits, _mm512_and_si512(_mm512_srli_epi16(block, 4), _mm512_set1_epi8(15)));
+		const __m512i row = _mm512_or_si512(_mm512_shuffle_epi8(low_rows, block), _mm512_shuffle_epi8(high_rows, _mm512_xor_si512(block, _mm512_set1_epi8(-128))));
+
+		return _mm512_test_epi8_mask(row, bit);
+	}
+#endif
+
+	// returns the shuffle controls that pack the bytes of an 8-byte group selected by each 8-bit mask to the front of the group (as a 64-bit integer whose first bytes are the indexes of the selected bytes).
+	static const std::array<std::uint64_t, 256>& pack_controls() noexcept
+	{
+		static constexpr std::array<std::uint64_t, 256> controls = []()
+		{
+			std::array<std::uint64_t, 256> controls_ = { };
+
+			for (unsigned mask = 0; mask < 256; ++mask)
+			{
+				unsigned n_packed = 0;
+
+				for (unsigned i = 0; i < 8; ++i)
+					if ((mask >> i) & 1)
+						controls_[mask] |= static_cast<std::uint64_t>(i) << (8 * n_packed++);
+			}
+
+			return controls_;
+		}();
+
+		return controls;
+	}
+
+#if defined(STR_SSSE3)
+	// writes the bytes of a given block selected by a given mask to a given position, packed, and returns the position past them. Up to 8 bytes past the packed ones are overwritten as well.
+	static char* pack_block(const __m128i block, const std::uint32_t kept, char* pos, const std::array<std::uint64_t, 256>& controls) noexcept
+	{
+		const __m128i control = _mm_add_epi8(_mm_set_epi64x(static_cast<long long>(controls[kept >> 8]), static_cast<long long>(controls[kept & 0xFF])), _mm_set_epi64x(0x0808080808080808, 0));
+		const __m128i packed = _mm_shuffle_epi8(block, control);
+
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(pos), packed);
+		pos += population_count(kept & 0xFF);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(pos), _mm_unpackhi_epi64(packed, packed));
+
+		return pos + population_count(kept >> 8);
+	}
+#endif
+#if defined(STR_AVX2)
+	static char* pack_block(const __m256i block, const std::uint32_t kept, char* pos, const std::array<std::uint64_t, 256>& controls) noexcept
+	{
+		const __m256i control = _mm256_add_epi8(_mm256_setr_epi64x(static_cast<long long>(controls[kept & 0xFF]), static_cast<long long>(controls[(kept >> 8) & 0xFF]), static_cast<long long>(controls[(kept >> 16) & 0xFF]), static_cast<long long>(controls[kept >> 24])), _mm256_setr_epi64x(0, 0x0808080808080808, 0, 0x0808080808080808));
+		const __m256i packed = _mm256_shuffle_epi8(block, control);
+		const __m128i low_packed = _mm256_castsi256_si128(packed), high_packed = _mm256_extracti128_si256(packed, 1);
+
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(pos), low_packed);
+		pos += population_count(kept & 0xFF);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(pos), _mm_unpackhi_epi64(low_packed, low_packed));
+		pos += population_count((kept >> 8) & 0xFF);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(pos), high_packed);
+		pos += population_count((kept >> 16) & 0xFF);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(pos), _mm_unpackhi_epi64(high_packed, high_packed));
+
+		return pos + population_count(kept >> 24);
+	}
+#endif
+#if defined(STR_AVX512)
+	static char* pack_block(const __m512i block, const std::uint64_t kept, char* const pos) noexcept
+	{
+		_mm512_storeu_si512(pos, _mm512_maskz_compress_epi8(kept, block));
+
+		return pos + population_count(kept);
+	}
+#endif
+
+	/*
+	writes the characters of given characters that are in a given class (if (keep) is true) or that are not (otherwise) to a given destination, in order, and returns the number of characters written.
+
+	the destination must have room for all the characters, and it may be the characters themselves (filtering them in place), as every block of characters is read before the packed characters are written over it. The characters of the destination past the written ones are unspecified. The blocks are packed with the compress instruction of AVX-512 (VBMI2), or with per-8-byte shuffle controls looked up by the mask of the kept characters on AVX2 and SSSE3, and the remaining characters are written unconditionally with the write position advanced only past the kept ones.
+	*/
+	template<bool keep> static size_t write_filtered(const char* chars, size_t len, char* const dest, const char_class& class_) noexcept
+	{
+		char* pos = dest;
+
+#if defined(STR_SSSE3)
+		const __m128i low_rows = _mm_loadu_si128(reinterpret_cast<const __m128i*>(class_.rows.data()));
+		const __m128i high_rows = _mm_loadu_si128(reinterpret_cast<const __m128i*>(class_.rows.data() + 16));
+		const std::array<std::uint64_t, 256>& controls = pack_controls();
+#endif
+#if defined(STR_AVX512)
+		const __m512i low_rows_512 = _mm512_maskz_broadcast_i32x4(0xFFFF, low_rows), high_rows_512 = _mm512_maskz_broadcast_i32x4(0xFFFF, high_rows);
+
+		for (; len >= 64; chars += 64, len -= 64)
+		{
+			const __m512i block = _mm512_loadu_si512(chars);
+			const std::uint64_t mask = match_class(block, low_rows_512, high_rows_512);
+
+			pos = pack_block(block, keep ? mask : ~mask, pos);
+		}
+#endif
+#if defined(STR_AVX2)
+		const __m256i low_rows_256 = _mm256_broadcastsi128_si256(low_rows), high_rows_256 = _mm256_broadcastsi128_si256(high_rows);
+
+		for (; len >= 32; chars += 32, len -= 32)
+		{
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars));
+			const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(match_class(block, low_rows_256, high_rows_256)));
+
+			pos = pack_block(block, keep ? mask : ~mask, pos, controls);
+		}
+#endif
+#if defined(STR_SSSE3)
+		for (; len >= 16; chars += 16, len -= 16)
+		{
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+			const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(match_class(block, low_rows, high_rows)));
+
+			pos = pack_block(block, keep ? mask : (~mask & 0xFFFF), pos, controls);
+		}
+#endif
+
+		const char_class scalar_class = class_;
+
+		for (; len != 0; ++chars, --len)
+		{
+			*pos = *chars;
+			pos += (scalar_class.contains(*chars) == keep);
+		}
+
+		return static_cast<size_t>(pos - dest);
+	}
+
+	// returns the number of characters of given characters that are in a given class, testing them 64, 32 or 16 at a time as (write_filtered) does.
+	static size_t count_class(const char* chars, size_t len, const char_class& class_) noexcept
+	{
+		size_t count = 0;
+
+#if defined(STR_SSSE3)
+		const __m128i low_rows = _mm_loadu_si128(reinterpret_cast<const __m128i*>(class_.rows.data()));
+		const __m128i high_rows = _mm_loadu_si128(reinterpret_cast<const __m128i*>(class_.rows.data() + 16));
+#endif
+#if defined(STR_AVX512)
+		const __m512i low_rows_512 = _mm512_maskz_broadcast_i32x4(0xFFFF, low_rows), high_rows_512 = _mm512_maskz_broadcast_i32x4(0xFFFF, high_rows);
+
+		for (; len >= 64; chars += 64, len -= 64)
+			count += population_count(match_class(_mm512_loadu_si512(chars), low_rows_512, high_rows_512));
+#endif
+#if defined(STR_AVX2)
+		const __m256i low_rows_256 = _mm256_broadcastsi128_si256(low_rows), high_rows_256 = _mm256_broadcastsi128_si256(high_rows);
+
+		for (; len >= 32; chars += 32, len -= 32)
+			count += population_count(static_cast<std::uint32_t>(_mm256_movemask_epi8(match_class(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars)), low_rows_256, high_rows_256))));
+#endif
+#if defined(STR_SSSE3)
+		for (; len >= 16; chars += 16, len -= 16)
+			count += population_count(static_cast<std::uint32_t>(_mm_movemask_epi8(match_class(_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars)), low_rows, high_rows))));
+#endif
+
+		for (; len != 0; ++chars, --len)
+			count += class_.contains(*chars);
+
+		return count;
+	}
+
+	// returns the number of UTF-8 characters in the range [pos, end) that represent English vowels, as (vowel_count) counts them, where the sequence of the last character may run past the range up to a given limit. Runs of ASCII characters are detected with vector instructions and their vowels counted as (count_class) counts them.
+	static size_t count_utf8_vowels(const char* pos, const char* const end, const char* const limit, const bool include_y) noexcept
+	{
+		const char_class vowels_(include_y ? "aeiouyAEIOUY" : "aeiouAEIOU");
+		size_t count = 0;
+
+		while (pos < end)
+		{
+			const size_t ascii_len = ascii_prefix_length(pos, static_cast<size_t>(end - pos));
+
+			if (ascii_len != 0)
+			{
+				count += count_class(pos, ascii_len, vowels_);
+				pos += ascii_len;
+
+				continue;
+			}
+
+			char32_t cp = 0;
+			const size_t cp_len = utf8_decode(pos, limit, cp);
+
+			if (cp_len != 0 && is_vowel(cp, include_y))
+				count++;
+
+			pos += std::max<size_t>(cp_len, 1);
+		}
+
+		return count;
+	}
+
+	// returns an STL string of the characters of given characters that are in a given class (if (keep) is true) or that are not (otherwise).
+	template<bool keep> static std::string filtered(const std::string_view str_, const char_class& class_)
+	{
+		std::string filtered_(str_.length(), '\0');
+		filtered_.resize(write_filtered<keep>(str_.data(), str_.length(), filtered_.data(), class_));
+
+		return filtered_;
+	}
+
+public:
+	// returns an STL string equivalent to a given STL string (or string view) without the characters of a given class (such as char_class::puncts() or char_class::controls()).
+	static std::string remove_if(const std::string_view str_, const char_class& class_)
+	{
+		return filtered<false>(str_, class_);
+	}
+	// writes given characters without the characters of a given class to a given destination with room for all of them (which may be the characters themselves, to filter them in place), and returns the number of characters written.
+	static size_t remove_if(const char* const chars, const size_t len, char* const dest, const char_class& class_) noexcept
+	{
+		return write_filtered<false>(chars, len, dest, class_);
+	}
+	// returns an extended string equivalent to this one without the characters of a given class.
+	str remove_if(const char_class& class_) const
+	{
+		return remove_if(std::string_view(_str), class_);
+	}
+
+	// returns an STL string of the characters of a given STL string (or string view) that are in a given class (such as char_class::alnums()).
+	static std::string keep_if(const std::string_view str_, const char_class& class_)
+	{
+		return filtered<true>(str_, class_);
+	}
+	// writes the characters of given characters that are in a given class to a given destination with room for all of them (which may be the characters themselves, to filter them in place), and returns the number of characters written.
+	static size_t keep_if(const char* const chars, const size_t len, char* const dest, const char_class& class_) noexcept
+	{
+		return write_filtered<true>(chars, len, dest, class_);
+	}
+	// returns an extended string of the characters of this extended string that are in a given class.
+	str keep_if(const char_class& class_) const
+	{
+		return keep_if(std::string_view(_str), class_);
+	}
+
+	// removes the characters of a given class from a given STL string in place, and returns the number of characters removed.
+	static size_t erase_if(std::string& str_, const char_class& class_) noexcept
+	{
+		const size_t len = str_.length();
+		str_.resize(write_filtered<false>(str_.data(), len, str_.data(), class_));
+
+		return len - str_.length();
+	}
+	// removes the characters of a given class from this extended string in place.
+	str& erase_if(const char_class& class_) noexcept
+	{
+		erase_if(_str, class_);
+		shrink_if_wasteful();
+
+		return *this;
+	}
+
+	// The case foldings that can be applied to the ASCII letters of a character sequence by (normalize_whitespace).
+	enum case_folding : std::int8_t { no_case_folding = 0, fold_to_lower = 1, fold_to_upper = 2 };
+
+private:
+	// returns a given character with its case folded, if it is an ASCII letter.
+	static constexpr char fold_case(const char c, const case_folding folding) noexcept
+	{
+		if (folding == fold_to_lower)
+			return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+		if (folding == fold_to_upper)
+			return (c >= 'a' && c <= 'z') ? static_cast<char>(c & ~0x20) : c;
+
+		return c;
+	}
+#if defined(STR_SSSE3)
+	// returns a given block with the case of its ASCII letters folded.
+	static __m128i fold_case(const __m128i block, const case_folding folding) noexcept
+	{
+		if (folding == no_case_folding)
+			return block;
+
+		const __m128i distance = _mm_sub_epi8(block, _mm_set1_epi8((folding == fold_to_lower) ? 'A' : 'a'));
+		const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(distance, _mm_set1_epi8(25)), distance);
+
+		return _mm_xor_si128(block, _mm_and_si128(is_letter, _mm_set1_epi8(0x20)));
+	}
+#endif
+#if defined(STR_AVX2)
+	static __m256i fold_case(const __m256i block, const case_folding folding) noexcept
+	{
+		if (folding == no_case_folding)
+			return block;
+
+		const __m256i distance = _mm256_sub_epi8(block, _mm256_set1_epi8((folding == fold_to_lower) ? 'A' : 'a'));
+		const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(distance, _mm256_set1_epi8(25)), distance);
+
+		return _mm256_xor_si256(block, _mm256_and_si256(is_letter, _mm256_set1_epi8(0x20)));
+	}
+#endif
+#if defined(STR_AVX512)
+	static __m512i fold_case(const __m512i block, const case_folding folding) noexcept
+	{
+		if (folding == no_case_folding)
+			return block;
+
+		const std::uint64_t is_letter = _mm512_cmple_epu8_mask(_mm512_sub_epi8(block, _mm512_set1_epi8((folding == fold_to_lower) ? 'A' : 'a')), _mm512_set1_epi8(25));
+
+		return _mm512_xor_si512(block, _mm512_maskz_mov_epi8(is_letter, _mm512_set1_epi8(0x20)));
+	}
+#endif
+
+	/*
+	writes given characters to a given destination with the characters of a given class (the whitespaces) trimmed from both ends, each run of them inside replaced by a given character, and the case of the ASCII letters folded as requested, and returns the number of characters written.
+
+	a whitespace is kept (as the replacement) only if the character before it is not a whitespace, with the characters before the first one counted as whitespaces, so the leading whitespaces are dropped with the rest of each run, and the replacement of the trailing run (if any) is dropped at the end. Each block is classified, folded and packed as by (write_filtered), in a single pass, and it may likewise be done in place.
+	*/
+	static size_t write_normalized(const char* chars, size_t len, char* const dest, const char_class& spaces, const char replacement, const case_folding folding) noexcept
+	{
+		char* pos = dest;
+		bool after_space = true;
+
+#if defined(STR_SSSE3)
+		const __m128i low_rows = _mm_loadu_si128(reinterpret_cast<const __m128i*>(spaces.rows.data()));
+		const __m128i high_rows = _mm_loadu_si128(reinterpret_cast<const __m128i*>(spaces.rows.data() + 16));
+		const std::array<std::uint64_t, 256>& controls = pack_controls();
+#endif
+#if defined(STR_AVX512)
+		const __m512i low_rows_512 = _mm512_maskz_broadcast_i32x4(0xFFFF, low_rows), high_rows_512 = _mm512_maskz_broadcast_i32x4(0xFFFF, high_rows);
+
+		for (; len >= 64; chars += 64, len -= 64)
+		{
+			const __m512i block = _mm512_loadu_si512(chars);
+			const std::uint64_t is_space = match_class(block, low_rows_512, high_rows_512);
+			const std::uint64_t kept = ~(is_space & ((is_space << 1) | after_space));
+
+			pos = pack_block(_mm512_mask_blend_epi8(is_space, fold_case(block, folding), _mm512_set1_epi8(replacement)), kept, pos);
+			after_space = (is_space >> 63) != 0;
+		}
+#endif
+#if defined(STR_AVX2)
+		const __m256i low_rows_256 = _mm256_broadcastsi128_si256(low_rows), high_rows_256 = _mm256_broadcastsi128_si256(high_rows);
+
+		for (; len >= 32; chars += 32, len -= 32)
+		{
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars));
+			const __m256i space_mask = match_class(block, low_rows_256, high_rows_256);
+			const std::uint32_t is_space = static_cast<std::uint32_t>(_mm256_movemask_epi8(space_mask));
+			const std::uint32_t kept = ~(is_space & ((is_space << 1) | after_space));
+
+			pos = pack_block(_mm256_blendv_epi8(fold_case(block, folding), _mm256_set1_epi8(replacement), space_mask), kept, pos, controls);
+			after_space = (is_space >> 31) != 0;
+		}
+#endif
+#if defined(STR_SSSE3)
+		for (; len >= 16; chars += 16, len -= 16)
+		{
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+			const __m128i space_mask = match_class(block, low_rows, high_rows);
+			const std::uint32_t is_space = static_cast<std::uint32_t>(_mm_movemask_epi8(space_mask));
+			const std::uint32_t kept = ~(is_space & ((is_space << 1) | after_space)) & 0xFFFF;
+			const __m128i replaced = _mm_or_si128(_mm_and_si128(space_mask, _mm_set1_epi8(replacement)), _mm_andnot_si128(space_mask, fold_case(block, folding)));
+
+			pos = pack_block(replaced, kept, pos, controls);
+			after_space = (is_space >> 15) != 0;
+		}
+#endif
+
+		const char_class scalar_spaces = spaces;
+
+		for (; len != 0; ++chars, --len)
+		{
+			const bool is_space = scalar_spaces.contains(*chars);
+
+			*pos = is_space ? replacement : fold_case(*chars, folding);
+			pos += !(is_space && after_space);
+			after_space = is_space;
+		}
+
+		if (after_space && pos != dest)
+			--pos;
+
+		return static_cast<size_t>(pos - dest);
+	}
+
+public:
+	/*
+	returns an STL string equivalent to a given STL string (or string view) with its whitespaces normalized in a single pass: the leading and trailing whitespaces are trimmed, each run of whitespaces inside is collapsed to a single replacement character (a space by default), and the ASCII letters are folded to lowercase or uppercase if requested.
+
+	a class of characters other than the whitespaces can be chosen (for example, char_class::spaces() | char_class::puncts()). The result is what splitting on the whitespaces, joining with the replacement and mapping the case would give, without the intermediate strings.
+	*/
+	static std::string normalize_whitespace(const std::string_view str_, const char replacement = ' ', const case_folding folding = no_case_folding, const char_class& spaces = char_class::spaces())
+	{
+		std::string normalized(str_.length(), '\0');
+		normalized.resize(write_normalized(str_.data(), str_.length(), normalized.data(), spaces, replacement, folding));
+
+		return normalized;
+	}
+	// writes given characters with their whitespaces normalized (as by the function above) to a given destination with room for all of them (which may be the characters themselves, to normalize them in place), and returns the number of characters written.
+	static size_t normalize_whitespace(const char* const chars, const size_t len, char* const dest, const char replacement = ' ', const case_folding folding = no_case_folding, const char_class& spaces = char_class::spaces()) noexcept
+	{
+		return write_normalized(chars, len, dest, spaces, replacement, folding);
+	}
+	// normalizes the whitespaces of a given STL string in place (as (normalize_whitespace) does).
+	static void normalize_whitespace_in_place(std::string& str_, const char replacement = ' ', const case_folding folding = no_case_folding, const char_class& spaces = char_class::spaces()) noexcept
+	{
+		str_.resize(write_normalized(str_.data(), str_.length(), str_.data(), spaces, replacement, folding));
+	}
+	// returns an extended string equivalent to this one with its whitespaces normalized: trimmed, collapsed to a single replacement character (a space by default) and, if requested, with the case of the ASCII letters folded.
+	str normalize_whitespace(const char replacement = ' ', const case_folding folding = no_case_folding, const char_class& spaces = char_class::spaces()) const
+	{
+		return normalize_whitespace(std::string_view(_str), replacement, folding, spaces);
+	}
+	// normalizes the whitespaces of this extended string in place.
+	str& normalize_whitespace_in_place(const char replacement = ' ', const case_folding folding = no_case_folding, const char_class& spaces = char_class::spaces()) noexcept
+	{
+		normalize_whitespace_in_place(_str, replacement, folding, spaces);
+		shrink_if_wasteful();
+
+		return *this;
+	}
+
+	// returns the STL string that is equivalent to another, albeit without the characters representing punctuation marks.
+	static std::string depunctuate(const std::string& str_, const char_encoding encoding = ascii)
+	{
+		if (encoding == utf8)
+			return remove_utf8_punct(str_);
+
+		return remove_if(str_, char_class::puncts());
+	}
+	// returns the STL string that is equivalent to another, albeit without the characters representing punctuation marks.
+	static std::string remove_punct(const std::string& str_, const char_encoding encoding = ascii)
+	{
+		return depunctuate(str_, encoding);
+	}
+
+	// returns this extended string that is equivalent to this one without the characters representing punctuation marks. In UTF-8 mode, punctuation marks beyond the ASCII range (such as « and ¿) are removed as well.
+	str depunctuate(const char_encoding encoding = ascii) const
+	{
+		return depunctuate(_str, encoding);
+	}
+	// returns this extended string that is equivalent to this one without the characters representing punctuation marks. In UTF-8 mode, punctuation marks beyond the ASCII range (such as « and ¿) are removed as well.
+	str remove_punct(const char_encoding encoding = ascii) const
+	{
+		return remove_punct(_str, encoding);
+	}
+
+private:
+	// returns an STL string equivalent to a given UTF-8 string, albeit without the code points representing punctuation marks. Runs of ASCII characters are detected with vector instructions and filtered as (remove_if) filters them, and invalid sequences are copied unchanged.
+	static std::string remove_utf8_punct(const std::string& str_)
+	{
+		std::string depunct_str = {};
+		depunct_str.reserve(str_.length());
+
+		const char* pos = str_.data();
+		const char* const end = pos + str_.length();
+
+		while (pos != end)
+		{
+			const size_t ascii_len = ascii_prefix_length(pos, static_cast<size_t>(end - pos));
+
+			if (ascii_len != 0)
+			{
+				const size_t off = depunct_str.length();
+
+				depunct_str.resize(off + ascii_len);
+				depunct_str.resize(off + write_filtered<false>(pos, ascii_len, &depunct_str[off], char_class::puncts()));
+
+				pos += ascii_len;
+
+				continue;
+			}
+
+			char32_t cp = 0;
+			const size_t cp_len = std::max<size_t>(utf8_decode(pos, end, cp), 1);
+
+			if (!is_punct(cp))
+				depunct_str.append(pos, cp_len);
+
+			pos += cp_len;
+		}
+
+		return depunct_str;
+	}
+
+public:
+
+	// returns an STL string containing the first character of each substring of a given STL string. By default, the substrings are delimited by whitespace characters, and the initials are separated by a space.
+	static std::string initials(const std::string& str_, const bool capitalize_init = false, const std::string& delim = " ", const std::string& delims = whitespaces)
+	{
+		return initials_of(str_, capitalize_init, delim, dynamic_delimiter_set(delims));
+	}
+	// returns an extended string containing the first character of each substring of this extended string. By default, the substrings are delimited by whitespace characters, and the initials are separated by a space.
+	str initials(const bool capitalize_init = false, const std::string& delim = " ", const std::string& delims = whitespaces) const
+	{
+		return initials(_str, capitalize_init, delim, delims);
+	}
+
+	// returns an STL string equivalent to a given one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	static std::string capitalize(const std::string& str_, const std::string& delims = whitespaces, const char_encoding encoding = ascii)
+	{
+		if (str_.empty())
+			return {};
+
+		if (encoding == utf8)
+			return map_utf8_initials(str_, delims, to_upper_case);
+
+		return map_initials(str_, dynamic_delimiter_set(delims), to_upper_case);
+	}
+	// returns an extended string equivalent this one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	str capitalize(const std::string& delims = whitespaces, const char_encoding encoding = ascii) const
+	{
+		return capitalize(_str, delims, encoding);
+	}
+
+	// returns an STL string equivalent a given one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	static std::string title(const std::string& str_, const std::string& delims = whitespaces, const char_encoding encoding = ascii)
+	{
+		if (str_.empty())
+			return {};
+
+		if (encoding == utf8)
+			return map_utf8_initials(str_, delims, to_upper_case);
+
+		return map_initials(str_, dynamic_delimiter_set(delims), to_upper_case);
+	}
+	// returns an extended string whose character sequence equivalent to this one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	str title(const std::string& delims = whitespaces, const char_encoding encoding = ascii) const
+	{
+		return title(_str, delims, encoding);
+	}
+
+	// returns an STL string equivalent to this one with the first character of each whitespace-delimited substring replaced by its lowercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	static std::string uncapitalize(const std::string& str_, const std::string& delims = whitespaces, const char_encoding encoding = ascii)
+	{
+		if (str_.empty())
+			return {};
+
+		if (encoding == utf8)
+			return map_utf8_initials(str_, delims, to_lower_case);
+
+		return map_initials(str_, dynamic_delimiter_set(delims), to_lower_case);
+	}
+	// returns an extended string equivalent to this one with the first character of each whitespace-delimited substring replaced by its uppercase counterpart. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	str uncapitalize(const std::string& delims = whitespaces, const char_encoding encoding = ascii) const
+	{
+		return uncapitalize(_str, delims, encoding);
+	}
+
+	// returns the number of whitespace-delimited substrings in a given STL string. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	static size_t word_count(const std::string& str_, const std::string& delims = whitespaces)
+	{
+		return count_words(str_, dynamic_delimiter_set(delims));
+	}
+	// returns the number of whitespace-delimited substrings in this extended string. (a delimiter or a set of delimiters other than whitespace characters can be defined).
+	size_t word_count(const std::string& delims = whitespaces) const
+	{
+		return word_count(_str, delims);
+	}
+
+	/*
+	the versions below of the delimiter-driven functions (word_count, split, capitalize, title and initials) take their delimiters as template arguments (as in word_count<' ', '\t'>(str_) or split<','>(str_)), so the matching of delimiters is specialized for them at compile time: a single delimiter is searched with (memchr), and up to 8 delimiters are matched with unrolled vector compares. The versions taking their delimiters at run time share the same code.
+	*/
+
+	// returns the number of substrings delimited by the template delimiters in a given STL string.
+	template<char... Delims> static size_t word_count(const std::string& str_)
+	{
+		return count_words(str_, static_delimiter_set<Delims...>());
+	}
+	// returns the number of substrings delimited by the template delimiters in this extended string.
+	template<char... Delims> size_t word_count() const
+	{
+		return word_count<Delims...>(_str);
+	}
+
+	// returns a C++ STL vector of the substrings delimited by any of the template delimiters in a given STL string. Empty substrings are left out.
+	template<char... Delims> static std::vector<std::string> split(const std::string& str_)
+	{
+		return split_words(str_, static_delimiter_set<Delims...>());
+	}
+	// returns a C++ STL vector of the substrings delimited by any of the template delimiters in this extended string. Empty substrings are left out.
+	template<char... Delims> std::vector<str> split() const
+	{
+		return vec_strs(split<Delims...>(_str));
+	}
+
+	// returns an STL string equivalent to a given one with the first character of each substring delimited by the template delimiters replaced by its uppercase counterpart.
+	template<char... Delims> static std::string capitalize(const std::string& str_, const char_encoding encoding = ascii)
+	{
+		if (encoding == utf8)
+			return map_utf8_initials(str_, { Delims... }, to_upper_case);
+
+		return map_initials(str_, static_delimiter_set<Delims...>(), to_upper_case);
+	}
+	// returns an extended string equivalent to this one with the first character of each substring delimited by the template delimiters replaced by its uppercase counterpart.
+	template<char... Delims> str capitalize(const char_encoding encoding = ascii) const
+	{
+		return capitalize<Delims...>(_str, encoding);
+	}
+
+	// returns an STL string equivalent to a given one with the first character of each substring delimited by the template delimiters replaced by its uppercase counterpart.
+	template<char... Delims> static std::string title(const std::string& str_, const char_encoding encoding = ascii)
+	{
+		return capitalize<Delims...>(str_, encoding);
+	}
+	// returns an extended string equivalent to this one with the first character of each substring delimited by the template delimiters replaced by its uppercase counterpart.
+	template<char... Delims> str title(const char_encoding encoding = ascii) const
+	{
+		return capitalize<Delims...>(_str, encoding);
+	}
+
+	// returns an STL string containing the first character of each substring delimited by the template delimiters in a given STL string. By default, the initials are separated by a space.
+	template<char... Delims> static std::string initials(const std::string& str_, const bool capitalize_init = false, const std::string& delim = " ")
+	{
+		return initials_of(str_, capitalize_init, delim, static_delimiter_set<Delims...>());
+	}
+	// returns an extended string containing the first character of each substring delimited by the template delimiters in this extended string. By default, the initials are separated by a space.
+	template<char... Delims> str initials(const bool capitalize_init = false, const std::string& delim = " ") const
+	{
+		return initials<Delims...>(_str, capitalize_init, delim);
+	}
+
+	/*
+	the parallel scans below are meant for very large strings (such as memory dumps and concatenated logs). The string is split into chunks of 256 KiB, which are scanned in parallel on the shared thread pool by a given number of threads (by default, every worker of the pool and the calling thread), and the results of the chunks are merged.
+
+	a chunk is the range of positions at which a match may start, and matches that cross the end of a chunk are found by extending the scan of the chunk past its end by the length of the pattern minus one (an overlap window), so each match is found exactly once.
+	*/
+
+	// returns the number of occurrences of a given substring in a given extended string, STL string, string view or character array, including overlapping occurrences (so (aa) occurs twice in (aaa)). The search is parallel.
+	template<class Str, class Substr> static size_t parallel_count(const Str& str_, const Substr& substr, const size_t n_threads = 0)
+	{
+		const std::string_view chars = view_of(str_), pattern = view_of(substr);
+
+		if (pattern.empty() || pattern.length() > chars.length())
+			return 0;
+
+		return parallel_scan(chars.length() - pattern.length() + 1, [&](const size_t begin, const size_t end)
+		{
+			size_t count = 0;
+
+			find_each(chars, pattern, begin, end, [&](size_t) { ++count; });
+
+			return count;
+		}, n_threads);
+	}
+	// returns the number of occurrences of a given substring in this extended string, including overlapping occurrences. The search is parallel.
+	template<class Substr> size_t parallel_count(const Substr& substr, const size_t n_threads = 0) const
+	{
+		return parallel_count(_str, substr, n_threads);
+	}
+
+	// returns the positions of all the occurrences of a given substring in a given extended string, STL string, string view or character array, in increasing order and including overlapping occurrences. The search is parallel.
+	template<class Str, class Substr> static std::vector<size_t> parallel_find_all(const Str& str_, const Substr& substr, const size_t n_threads = 0)
+	{
+		const std::string_view chars = view_of(str_), pattern = view_of(substr);
+
+		if (pattern.empty() || pattern.length() > chars.length())
+			return {};
+
+		const size_t n_starts = chars.length() - pattern.length() + 1;
+		const size_t n_chunks = (n_starts + scan_chunk_size - 1) / scan_chunk_size;
+		std::vector<std::vector<size_t>> positions(n_chunks);
+
+		parallel_for(n_chunks, [&](const size_t c)
+		{
+			find_each(chars, pattern, c * scan_chunk_size, std::min((c + 1) * scan_chunk_size, n_starts), [&](const size_t pos) { positions[c].push_back(pos); });
+		}, n_threads);
+
+		size_t n_positions = 0;
+
+		for (const std::vector<size_t>& positions_ : positions)
+			n_positions += positions_.size();
+
+		std::vector<size_t> all_positions = { };
+		all_positions.reserve(n_positions);
+
+		for (const std::vector<size_t>& positions_ : positions)
+			all_positions.insert(all_positions.end(), positions_.begin(), positions_.end());
+
+		return all_positions;
+	}
+	// returns the positions of all the occurrences of a given substring in this extended string, in increasing order and including overlapping occurrences. The search is parallel.
+	template<class Substr> std::vector<size_t> parallel_find_all(const Substr& substr, const size_t n_threads = 0) const
+	{
+		return parallel_find_all(_str, substr, n_threads);
+	}
+
+	// returns the number of whitespace-delimited substrings in a given extended string, STL string or string view, as (word_count) does. (a delimiter or a set of delimiters other than whitespace characters can be defined). Counting is parallel.
+	template<class Str, if_string_type<Str> = 0> static size_t parallel_word_count(const Str& str_, const std::string& delims = whitespaces, const size_t n_threads = 0)
+	{
+		const std::string_view chars = view_of(str_);
+		const dynamic_delimiter_set delims_(delims);
+
+		// a word crossing the start of a chunk is counted with the previous chunk only.
+		return parallel_scan(chars.length(), [&](const size_t begin, const size_t end)
+		{
+			const bool continues_word = (begin != 0) && !delims_.contains(chars[begin - 1]) && !delims_.contains(chars[begin]);
+
+			return count_words(chars.substr(begin, end - begin), delims_) - continues_word;
+		}, n_threads);
+	}
+	// returns the number of whitespace-delimited substrings in this extended string, as (word_count) does. (a delimiter or a set of delimiters other than whitespace characters can be defined). Counting is parallel.
+	size_t parallel_word_count(const std::string& delims = whitespaces, const size_t n_threads = 0) const
+	{
+		return parallel_word_count(_str, delims, n_threads);
+	}
+
+	// returns the count of characters representing English vowels in a given extended string, STL string or string view, as (vowel_count) does. In UTF-8 mode, the chunks are aligned to code point boundaries. Counting is parallel.
+	template<class Str, if_string_type<Str> = 0> static size_t parallel_vowel_count(const Str& str_, const bool include_y = false, const char_encoding encoding = ascii, const size_t n_threads = 0)
+	{
+		const std::string_view chars = view_of(str_);
+
+		// moves a given position past continuation bytes (at most three, the longest run in a valid sequence), to the start of the code point containing it.
+		const auto code_point_start = [&](size_t pos)
+		{
+			for (size_t i = 0; i < 3 && pos < chars.length() && (static_cast<unsigned char>(chars[pos]) & 0xC0) == 0x80; ++i)
+				++pos;
+
+			return pos;
+		};
+
+		return parallel_scan(chars.length(), [&](size_t begin, size_t end)
+		{
+			size_t count = 0;
+
+			if (encoding == utf8)
+				return count_utf8_vowels(chars.data() + code_point_start(begin), chars.data() + code_point_start(end), chars.data() + chars.length(), include_y);
+
+			for (size_t i = begin; i < end; ++i)
+				count += is_vowel(chars[i], include_y);
+
+			return count;
+		}, n_threads);
+	}
+	// returns the count of characters representing English vowels in this extended string, as (vowel_count) does. Counting is parallel.
+	size_t parallel_vowel_count(const bool include_y = false, const char_encoding encoding = ascii, const size_t n_threads = 0) const
+	{
+		return parallel_vowel_count(_str, include_y, encoding, n_threads);
+	}
+
+private:
+#if defined(STR_SSE2)
+	// returns a given block with the order of its characters reversed.
+	static __m128i reverse_block(const __m128i block) noexcept
+	{
+#if defined(STR_SSSE3)
+		return _mm_shuffle_epi8(block, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+		// swaps the characters of each pair, then reverses the order of the pairs.
+		const __m128i swapped = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+
+		return _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(swapped, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(1, 0, 3, 2));
+#endif
+	}
+#endif
+#if defined(STR_AVX2)
+	static __m256i reverse_block(const __m256i block) noexcept
+	{
+		const __m256i reversed_lanes = _mm256_shuffle_epi8(block, _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+
+		return _mm256_permute2x128_si256(reversed_lanes, reversed_lanes, 1);
+	}
+#endif
+#if defined(STR_AVX512)
+	static __m512i reverse_block(const __m512i block) noexcept
+	{
+		const __m512i reversed_lanes = _mm512_shuffle_epi8(block, _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)));
+
+		return _mm512_maskz_permutexvar_epi64(0xFF, _mm512_setr_epi64(6, 7, 4, 5, 2, 3, 0, 1), reversed_lanes);
+	}
+#endif
+
+	// reverses the order of the characters in the range [first, last) in place, swapping reversed 64, 32 or 16-character blocks from both ends where vector instructions are available.
+	static void reverse_chars(char* first, char* last) noexcept
+	{
+#if defined(STR_AVX512)
+		for (; last - first >= 128; first += 64, last -= 64)
+		{
+			const __m512i front = _mm512_loadu_si512(first), back = _mm512_loadu_si512(last - 64);
+
+			_mm512_storeu_si512(first, reverse_block(back));
+			_mm512_storeu_si512(last - 64, reverse_block(front));
+		}
+#endif
+#if defined(STR_AVX2)
+		for (; last - first >= 64; first += 32, last -= 32)
+		{
+			const __m256i front = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), back = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last - 32));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(first), reverse_block(back));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(last - 32), reverse_block(front));
+		}
+#endif
+#if defined(STR_SSE2)
+		for (; last - first >= 32; first += 16, last -= 16)
+		{
+			const __m128i front = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), back = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last - 16));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(first), reverse_block(back));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(last - 16), reverse_block(front));
+		}
+#endif
+
+		std::reverse(first, last);
+	}
+
+public:
+	// returns an STL string that is the result of reversing the order of the characters of a given one.
+	static std::string reverse(const std::string& str_)
+	{
+		std::string str_r = str_;
+		reverse_in_place(str_r);
+
+		return str_r;
+	}
+	// returns an extended string that is the result of reversing the order of the characters of this one.
+	str reverse() const
+	{
+		return reverse(_str);
+	}
+	// reverses the order of the characters of a given STL string in place.
+	static void reverse_in_place(std::string& str_) noexcept
+	{
+		reverse_chars(str_.data(), str_.data() + str_.length());
+	}
+	// reverses the order of the characters of this extended string in place.
+	str& reverse_in_place() noexcept
+	{
+		reverse_in_place(_str);
+
+		return *this;
+	}
+
+	/*
+	reverses the order of the substrings of a given STL string delimited by a given delimiter (a space by default) in place, as (reverse_words) does: the empty substrings are left out, and the remaining ones are separated by a single delimiter. The delimiter can have more than one character.
+
+	the work is linear and nothing is allocated: the substrings are moved to the front with the empty ones left out, each of them (and each delimiter between them) is reversed as it is moved, and then the whole string is reversed, which restores the order of the characters within each substring and delimiter while reversing the order of the substrings.
+	*/
+	static void reverse_words_in_place(std::string& str_, const std::string& delim = " ") noexcept
+	{
+		if (delim.empty())
+			return;
+
+		char* const chars = str_.data();
+		const std::string_view text(chars, str_.length());
+		size_t start_pos = 0, len_r = 0;
+
+		while (start_pos < text.length())
+		{
+			size_t delim_pos = text.find(delim, start_pos);
+
+			if (delim_pos == std::string_view::npos)
+				delim_pos = text.length();
+
+			// the moved substring ends before the delimiter found, so the characters searched next are never overwritten.
+			if (delim_pos != start_pos)
+			{
+				const size_t word_len = delim_pos - start_pos;
+
+				if (len_r != 0)
+				{
+					std::reverse_copy(delim.begin(), delim.end(), chars + len_r);
+					len_r += delim.length();
+				}
+				if (len_r != start_pos)
+					std::memmove(chars + len_r, chars + start_pos, word_len);
+
+				reverse_chars(chars + len_r, chars + len_r + word_len);
+				len_r += word_len;
+			}
+
+			start_pos = delim_pos + delim.length();
+		}
+
+		reverse_chars(chars, chars + len_r);
+		str_.resize(len_r);
+	}
+	// returns an STL string equivalent to a given one with the order of the substrings delimited by a given delimiter (a space by default) reversed. The empty substrings are left out. See (reverse_words_in_place).
+	static std::string reverse_words(const std::string& str_, const std::string& delim = " ")
+	{
+		std::string str_r = str_;
+		reverse_words_in_place(str_r, delim);
+
+		return str_r;
+	}
+	// returns an extended string equivalent to a given one with the order of the substrings delimited by a given delimiter (a space by default) reversed.
+	str reverse_words(const std::string& delim = " ") const
+	{
+		return reverse_words(_str, delim);
+	}
+
+	// TODO: static function versions of (find) that return an STL string.
+	// TODO: document (find).
+	
+	size_t find(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find(to_lower(str_._str));
+
+		return search_in.find(str_._str);
+	}
+	size_t find(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find(to_lower(str_));
+
+		return search_in.find(str_);
+	}
+	size_t find(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find(to_lower(char_arr));
+
+		return search_in.find(char_arr);
+	}
+	size_t find(const char* char_arr, const bool case_sensitive = true, const std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find(to_lower(char_arr).c_str(), 0, n);
+		
+		return search_in.find(char_arr, 0, n);
+	}
+	size_t find(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find(std::tolower(c));
+
+		return search_in.find(c);
+	}
+
+	size_t r_find(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).rfind(to_lower(str_._str));
+
+		return search_in.rfind(str_._str);
+	}
+	size_t r_find(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).rfind(to_lower(str_));
+
+		return search_in.rfind(str_);
+	}
+	size_t r_find(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).rfind(to_lower(char_arr));
+
+		return search_in.rfind(char_arr);
+	}
+	size_t r_find(const char* char_arr, const bool case_sensitive = true, std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).rfind(to_lower(char_arr).c_str(), 0, n);
+		
+		return search_in.rfind(char_arr, 0, n);
+	}
+	size_t r_find(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
+	{
+		const std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).rfind(std::tolower(c));
+
+		return search_in.rfind(c);
+	}
+
+	size_t find_first_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_of(to_lower(str_._str));
+
+		return search_in.find_first_of(str_._str);
+	}
+	size_t find_first_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_of(to_lower(str_));
+
+		return search_in.find_first_of(str_);
+	}
+	size_t find_first_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_of(to_lower(char_arr));
+
+		return search_in.find_first_of(char_arr);
+	}
+	size_t find_first_of(const char* char_arr, const bool case_sensitive = true, const std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_of(to_lower(char_arr).c_str(), 0, n);
+		
+		return search_in.find_first_of(char_arr, 0, n);
+	}
+
+	size_t find_last_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_of(to_lower(str_._str));
+
+		return search_in.find_first_of(str_._str);
+	}
+	size_t find_last_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_of(to_lower(str_));
+
+		return search_in.find_last_of(str_);
+	}
+	size_t find_last_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_of(to_lower(char_arr));
+
+		return search_in.find_last_of(char_arr);
+	}
+	size_t find_last_of(const char* char_arr, const bool case_sensitive = true, const std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_of(to_lower(char_arr).c_str(), 0, n);
+		
+		return search_in.find_last_of(char_arr, 0, n);
+	}
+
+	size_t find_first_not_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_not_of(to_lower(str_._str));
+
+		return search_in.find_first_not_of(str_._str);
+	}
+	size_t find_first_not_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_not_of(to_lower(str_));
+
+		return search_in.find_first_not_of(str_);
+	}
+	size_t find_first_not_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_not_of(to_lower(char_arr));
+
+		return search_in.find_first_not_of(char_arr);
+	}
+	size_t find_first_not_of(const char* char_arr, const bool case_sensitive = true, std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_not_of(to_lower(char_arr).c_str(), 0, n);
+		
+		return search_in.find_first_not_of(char_arr, 0, n);
+	}
+	size_t find_first_not_of(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
+	{
+		const std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_first_not_of(std::tolower(c));
+
+		return search_in.find_first_not_of(c);
+	}
+
+	size_t find_last_not_of(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const noexcept
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_not_of(to_lower(str_._str));
+
+		return search_in.find_last_not_of(str_._str);
+	}
+	size_t find_last_not_of(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_not_of(to_lower(str_));
+
+		return search_in.find_last_not_of(str_);
+	}
+	size_t find_last_not_of(const char* char_arr, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_not_of(to_lower(char_arr));
+
+		return search_in.find_last_not_of(char_arr);
+	}
+	size_t find_last_not_of(const char* char_arr, const bool case_sensitive = true, std::string::size_type n = 0, const size_t pos = 0, const size_t len = 0) const
+	{
+		std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_not_of(to_lower(char_arr).c_str(), 0, n);
+		
+		return search_in.find_last_not_of(char_arr, 0, n);
+	}
+	size_t find_last_not_of(const char c, const bool case_sensitive = true, const size_t pos = 0, const size_t len = 0) const noexcept
+	{
+		const std::string search_in = _str.substr(pos, len);
+
+		if (!case_sensitive)
+			return to_lower(search_in).find_last_not_of(std::tolower(c));
+
+		return search_in.find_last_not_of(c);
+	}
+
+	// TODO: static function versions of (replace) that return an STL string.
+	// TODO: document (replace).
+	
+	str& replace(const str& replace_with, const size_t this_pos, const size_t this_len, const size_t that_pos = 0, const size_t that_len = std::string::npos)
+	{
+		return replace(replace_with._str, this_pos, this_len, that_pos, that_len);
+	}
+	str& replace(const str& replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+	{
+		return replace(replace_with._str, this_begin, this_end);
+	}
+	str& replace(const std::string& replace_with, const size_t this_pos, const size_t this_len, const size_t that_pos = 0, const size_t that_len = std::string::npos)
+	{
+		replace_within_policy(substr_length(_str.length(), this_pos, this_len), substr_length(replace_with.length(), that_pos, that_len), [&](std::string& str_) { str_.replace(this_pos, this_len, replace_with, that_pos, that_len); });
+
+		return *this;
+	}
+	str& replace(const std::string& replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+	{
+		return replace(replace_with, static_cast<size_t>(this_begin - _str.cbegin()), static_cast<size_t>(this_end - this_begin));
+	}
+	str& replace(const char* replace_with, const size_t this_pos, const size_t this_len, const size_t that_pos = 0, const size_t that_len = std::string::npos)
+	{
+		const std::string_view replace_with_(replace_with);
+
+		replace_within_policy(substr_length(_str.length(), this_pos, this_len), substr_length(replace_with_.length(), that_pos, that_len), [&](std::string& str_) { str_.replace(this_pos, this_len, replace_with_, that_pos, that_len); });
+
+		return *this;
+	}
+	str& replace(const char* replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+	{
+		return replace(replace_with, static_cast<size_t>(this_begin - _str.cbegin()), static_cast<size_t>(this_end - this_begin));
+	}
+	str& replace(const char c, const size_t this_pos, const size_t this_len, const size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
+	{
+		return replace(repeat(c, n, sep, delim), this_pos, this_len);
+	}
+	str& replace(const char c, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end, size_t n = 1, const std::string& sep = std::string(), const std::string& delim = std::string())
+	{
+		return replace(repeat(c, n, sep, delim), this_begin, this_end);
+	}
+	str& replace(const std::initializer_list<char> replace_with, const std::string::const_iterator& this_begin, const std::string::const_iterator& this_end)
+	{
+		const size_t this_pos = static_cast<size_t>(this_begin - _str.cbegin()), this_len = static_cast<size_t>(this_end - this_begin);
+
+		replace_within_policy(this_len, replace_with.size(), [&](std::string& str_) { str_.replace(this_pos, this_len, replace_with.begin(), replace_with.size()); });
+
+		return *this;
+	}
+	
+	static std::string& find_and_replace(std::string& str_, const std::string& to_find, const std::string& to_replace, const bool case_sensitive = true)
+	{
+		size_t pos = case_sensitive ? str_.find(to_find) : to_lower(str_).find(to_lower(to_find));
+		const size_t len = str_.length();
+
+		while (pos != std::string::npos)
+		{
+			str_.replace(pos, len, to_replace);
+			pos = case_sensitive ? str_.find(to_find) : to_lower(str_).find(to_lower(to_find));
+		}
+
+		return str_;
+	}
+	str& find_and_replace(const str& to_find, const str& to_replace, const bool case_sensitive = true)
+	{
+		size_t pos = case_sensitive ? _str.find(to_find._str) : to_lower(_str).find(to_lower(to_find._str));
+		const size_t len = length();
+
+		while (pos != std::string::npos)
+		{
+			replace(to_replace._str, pos, len);
+			pos = case_sensitive ? _str.find(to_find._str) : to_lower(_str).find(to_lower(to_find._str));
+		}
+
+		return *this;
+	}
+
+	/*
+	A glob (wildcard) pattern, compiled once to be matched against any number of strings. Matching is case-sensitive unless specified otherwise.
+
+	in a pattern, (*) matches any sequence of characters (including an empty one), (?) matches any single character, and a bracket expression matches any single character of a class, as in [abc], [a-z] or [a-zA-Z_], or any single character not in it, as in [!0-9] or [^0-9]. A backslash matches the character that follows it literally, and an unterminated bracket is matched literally.
+
+	the pattern is split at its stars into pieces. The first piece must match at the beginning of a string, the last one at its end, and each one in between is matched at its leftmost occurrence after the previous one, which never needs to backtrack. Literal pieces are searched for as whole strings (unless matching is case-insensitive), and the others with a bit-parallel (Shift-And) automaton that reads each character once, so the time taken is linear in the length of the string for a given pattern, as long as no piece has more than 64 elements (characters, question marks and bracket expressions); the occurrences of the first 64 elements of a longer piece are found the same way, but each one is then checked against the rest of the piece. The literal prefix and suffix of the pattern are checked before anything else.
+	*/
+	class glob
+	{
+		// A piece of a pattern (a part of it between two stars): the offset of its first element, its number of elements, the string it matches, if all of its elements are literal characters, and, unless it is searched for as that string, the bit mask of the elements (among its first 64) that match each character.
+		struct piece
+		{
+			size_t first, len;
+			bool is_literal;
+			std::string literal;
+			std::vector<std::uint64_t> masks;
+		};
+
+		// the set of characters matched by each element of the pattern.
+		std::vector<std::array<bool, 256>> elements = {};
+		std::vector<piece> pieces = {};
+		bool case_sensitive = true;
+
+		// returns whether the elements of a given piece match the characters of a given string starting from a given offset (which must leave room for the whole piece).
+		bool match_at(const piece& piece_, const std::string_view str_, const size_t pos) const noexcept
+		{
+			for (size_t i = 0; i < piece_.len; ++i)
+			{
+				if (!elements[piece_.first + i][static_cast<unsigned char>(str_[pos + i])])
+					return false;
+			}
+
+			return true;
+		}
+
+		// returns the offset of the leftmost occurrence of a given piece in a given string between two given offsets, or (npos) if there is none.
+		size_t find(const piece& piece_, const std::string_view str_, const size_t pos, const size_t end) const noexcept
+		{
+			if (end - pos < piece_.len)
+				return std::string::npos;
+
+			if (piece_.len == 0)
+				return pos;
+
+			if (piece_.is_literal && case_sensitive)
+				return str_.substr(0, end).find(piece_.literal, pos);
+
+			// bit (k) of the state is set when the first (k + 1) elements match the characters ending at the current one.
+			const size_t n_masked = std::min<size_t>(piece_.len, 64);
+			const std::uint64_t found = std::uint64_t(1) << (n_masked - 1);
+			std::uint64_t state = 0;
+
+			for (size_t i = pos; i < end; ++i)
+			{
+				state = ((state << 1) | 1) & piece_.masks[static_cast<unsigned char>(str_[i])];
+
+				if (state & found)
+				{
+					const size_t start = i + 1 - n_masked;
+
+					if (start + piece_.len > end)
+						break;
+
+					if (n_masked == piece_.len || match_at(piece_, str_, start))
+						return start;
+				}
+			}
+
+			return std::string::npos;
+		}
+
+	public:
+		// compiles a given glob pattern. Matching is case-sensitive by default.
+		explicit glob(const std::string_view pattern, const bool case_sensitive_ = true) : case_sensitive(case_sensitive_)
+		{
+			pieces.push_back({ 0, 0, true, {}, {} });
+
+			for (size_t i = 0; i < pattern.length(); ++i)
+			{
+				std::array<bool, 256> element = { };
+				bool is_literal = false, is_negated = false;
+				char c = pattern[i];
+
+				if (c == '*')
+				{
+					pieces.push_back({ elements.size(), 0, true, {}, {} });
+
+					continue;
+				}
+
+				if (c == '?')
+					element.fill(true);
+				else if (c == '[' && pattern.find(']', i + 2) != std::string::npos)
+				{
+					const bool negate = (pattern[i + 1] == '!' || pattern[i + 1] == '^');
+					size_t j = i + (negate ? 2 : 1);
+
+					// a closing bracket right after the opening one is a member of the class.
+					for (bool is_first = true; j < pattern.length() && (is_first || pattern[j] != ']'); is_first = false)
+					{
+						unsigned char lo = static_cast<unsigned char>(pattern[j] == '\\' && j + 1 < pattern.length() ? pattern[++j] : pattern[j]);
+						unsigned char hi = lo;
+						++j;
+
+						if (j + 1 < pattern.length() && pattern[j] == '-' && pattern[j + 1] != ']')
+						{
+							hi = static_cast<unsigned char>(pattern[j + 1] == '\\' && j + 2 < pattern.length() ? pattern[j += 2] : pattern[++j]);
+							++j;
+						}
+
+						for (unsigned c_ = lo; c_ <= hi; ++c_)
+							element[c_] = true;
+					}
+
+					if (j >= pattern.length())
+					{
+						// an unterminated bracket expression: the bracket is matched literally.
+						element = { };
+						element[static_cast<unsigned char>('[')] = true;
+						is_literal = true;
+						c = '[';
+					}
+					else
+					{
+						is_negated = negate;
+						i = j;
+					}
+				}
+				else
+				{
+					if (c == '\\' && i + 1 < pattern.length())
+						c = pattern[++i];
+
+					element[static_cast<unsigned char>(c)] = true;
+					is_literal = true;
+				}
+
+				if (!case_sensitive)
+				{
+					for (unsigned c_ = 'A'; c_ <= 'Z'; ++c_)
+						element[c_] = element[c_ + ('a' - 'A')] = (element[c_] || element[c_ + ('a' - 'A')]);
+				}
+
+				// a class is negated once its case is folded, so that [!a] matches neither (a) nor (A) when matching is case-insensitive.
+				if (is_negated)
+				{
+					for (bool& is_member : element)
+						is_member = !is_member;
+				}
+
+				piece& piece_ = pieces.back();
+
+				elements.push_back(element);
+				++piece_.len;
+
+				piece_.is_literal = piece_.is_literal && is_literal;
+
+				if (piece_.is_literal)
+					piece_.literal.push_back(c);
+			}
+
+			for (piece& piece_ : pieces)
+			{
+				if (piece_.len == 0 || (piece_.is_literal && case_sensitive))
+					continue;
+
+				piece_.masks.assign(256, 0);
+
+				for (size_t i = 0; i < std::min<size_t>(piece_.len, 64); ++i)
+				{
+					for (unsigned c = 0; c < 256; ++c)
+					{
+						if (elements[piece_.first + i][c])
+							piece_.masks[c] |= std::uint64_t(1) << i;
+					}
+				}
+			}
+		}
+
+		// returns whether a given string matches this pattern.
+		bool matches(const std::string_view str_) const noexcept
+		{
+			const piece& first = pieces.front();
+			const piece& last = pieces.back();
+
+			if (pieces.size() == 1)
+				return (str_.length() == first.len) && match_at(first, str_, 0);
+
+			size_t min_len = 0;
+
+			for (const piece& piece_ : pieces)
+				min_len += piece_.len;
+
+			if (str_.length() < min_len)
+				return false;
+
+			// the literal prefix and suffix are checked before anything else.
+			if ((first.is_literal && case_sensitive) ? (str_.compare(0, first.len, first.literal) != 0) : !match_at(first, str_, 0))
+				return false;
+
+			const size_t end = str_.length() - last.len;
+
+			if ((last.is_literal && case_sensitive) ? (str_.compare(end, last.len, last.literal) != 0) : !match_at(last, str_, end))
+				return false;
+
+			size_t pos = first.len;
+
+			for (size_t i = 1; i + 1 < pieces.size(); ++i)
+			{
+				const size_t found = find(pieces[i], str_, pos, end);
+
+				if (found == std::string::npos)
+					return false;
+
+				pos = found + pieces[i].len;
+			}
+
+			return true;
+		}
+	};
+
+	// returns whether a given character sequence matches a given glob pattern.
+	static bool matches(const std::string_view str_, const glob& pattern) noexcept
+	{
+		return pattern.matches(str_);
+	}
+	// returns whether this extended string matches a given glob pattern.
+	bool matches(const glob& pattern) const noexcept
+	{
+		return pattern.matches(_str);
+	}
+
+	// returns the offsets (in increasing order) of the strings of a given C++ STL container (of extended strings, STL strings, string views or character arrays) that match a given glob pattern. Large containers are split into chunks that are matched in parallel by a given number of threads (the number of hardware threads by default).
+	template<class Cont> static std::vector<size_t> filter(const Cont& strs, const glob& pattern, const size_t n_threads = 0)
+	{
+		const auto first = std::begin(strs);
+		const size_t n = static_cast<size_t>(std::end(strs) - first);
+
+		constexpr size_t chunk_len = 1 << 14;
+		const size_t n_chunks = (n + chunk_len - 1) / chunk_len;
+
+		std::vector<std::vector<size_t>> chunk_matches(n_chunks);
+
+		parallel_for(n_chunks, [&](const size_t c)
+		{
+			for (size_t i = c * chunk_len; i < std::min(n, (c + 1) * chunk_len); ++i)
+			{
+				if (pattern.matches(view_of(first[i])))
+					chunk_matches[c].push_back(i);
+			}
+		}, n_threads);
+
+		std::vector<size_t> matches_ = {};
+
+		for (const std::vector<size_t>& chunk_matches_ : chunk_matches)
+			matches_.insert(matches_.end(), chunk_matches_.begin(), chunk_matches_.end());
+
+		return matches_;
+	}
+	
+	// TODO: static function versions of (compare) that take an STL string.
+	// TODO: document (compare).
+	
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of two STL strings . (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const std::string& str_l, const std::string& str_r, const bool case_sensitive = true, size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos) 
+	{
+		if (case_sensitive)
+			return str_l.compare(pos_l, len_l, str_r.substr(pos_r, len_r));
+
+		const std::string str_l_ = to_lower(str_l).substr(pos_l, len_l);
+		const std::string str_r_ = to_lower(str_r).substr(pos_r, len_r);
+
+		return str_l_.compare(str_r);
+	}
+	
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of two extended strings. (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const str& str_l, const str& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		return compare(str_l._str, str_r._str, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of this extended string and another. (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	int compare(const str& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos, const size_t pos_ = 0, const size_t len_ = std::string::npos) const
+	{
+		return compare(*this, str_, case_sensitive, pos, len, pos_, len_);
+	}
+
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an extended string on the left hand side and an STL string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const str& str_l, const std::string& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		return compare(str_l._str, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an STL string on the left hand side and an extended string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const std::string& str_l, const str& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		return compare(str_l, str_r._str, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of this extended string on the left hand side and an STL string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	int compare(const std::string& str_, const bool case_sensitive = true, const size_t pos = 0, const size_t len = std::string::npos, const size_t pos_ = 0, const size_t len_ = std::string::npos) const
+	{
+		return compare(_str, str_, case_sensitive, pos, len, pos_, len_);
+	}
+
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of two character arrays. (sub-arrays can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two character arrays are equal.
+	(B) smaller than zero
+		if the first character of the left-hand array that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand array that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const char* char_arr_l, const char* char_arr_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		const std::string str_l = char_arr_l, str_r = char_arr_r;
+		
+		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an STL string on the left hand side and a character array on the right hand side. (sub-strings/sub-arrays can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const std::string& str_l, const char* char_arr_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		const std::string str_r = char_arr_r;
+		
+		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of a character array on the left hand side and an STL string on the right hand side. (sub-strings/sub-arrays can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal (having the same character sequence).
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const char* char_arr_l, const std::string& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		const std::string str_l = char_arr_l;
+		
+		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of an extended string on the left hand side and a character array on the right hand side. (substrings/sub-arrays can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal (having the same character sequence).
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const str& str_l, const char* char_arr_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		const std::string str_r = char_arr_r;
+		
+		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequences of a character array on the left hand side and an extended string on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal (having the same character sequence).
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	static int compare(const char* char_arr_l, const str& str_r, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos)
+	{
+		const std::string str_l = char_arr_l;
+
+		return compare(str_l, str_r, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) lexicographical comparison between the character sequence of this extended string on the left hand side with that of a character array on the right hand side. (substrings can be defined through a starting offset and a length that includes the said offset).
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal (having the same character sequence).
+	(B) smaller than zero
+		if the first character of the left-hand string that does not match has a smaller ASCII value, or if the entire left-hand string matches but has a smaller length.
+	(C) greater than zero
+		if the first character of the left-hand string that does not match has a greater ASCII value, or if the entire left-hand string matches but has a greater length.
+	*/
+	int compare(const char* char_arr, const bool case_sensitive = true, const size_t pos_l = 0, const size_t len_l = std::string::npos, const size_t pos_r = 0, const size_t len_r = std::string::npos) const
+	{
+		const std::string str_ = char_arr;
+		
+		return compare(_str, str_, case_sensitive, pos_l, len_l, pos_r, len_r);
+	}
+
+	/*
+	returns an integer indicating the result of performing a (by default, case-sensitive) comparison between the character sequences of two strings in natural ("human") order, in which runs of decimal digits are compared by their numeric values, so that "file2" precedes "file10". All other characters are compared one by one, as in a lexicographical comparison.
+
+	digit runs are compared digit by digit rather than being parsed into integers, so they can be of any length, and no memory is allocated. Runs having the same numeric value but a different number of leading zeroes (as in "file2" and "file02") are considered equivalent unless the rest of the strings are equal, in which case the string with fewer leading zeroes precedes the other.
+
+	the returned value is:
+	(A) equal to 0
+		if the two strings are equal.
+	(B) smaller than zero
+		if the left-hand string precedes the right-hand string in natural order.
+	(C) greater than zero
+		if the left-hand string follows the right-hand string in natural order.
+	*/
+	static int natural_compare(const std::string_view str_l, const std::string_view str_r, const bool case_sensitive = true) noexcept
+	{
+		const auto is_digit = [](const char c) { return static_cast<unsigned char>(c - '0') < 10; };
+
+		size_t i = 0, j = 0;
+		const size_t len_l = str_l.length(), len_r = str_r.length();
+
+		// the result of comparing the numbers of leading zeroes of the first pair of equivalent digit runs that differ in that respect.
+		int zeroes_cmp = 0;
+
+		while (i < len_l && j < len_r)
+		{
+			if (is_digit(str_l[i]) && is_digit(str_r[j]))
+			{
+				const size_t start_l = i, start_r = j;
+
+				while (i < len_l && str_l[i] == '0')
+					++i;
+				while (j < len_r && str_r[j] == '0')
+					++j;
+
+				size_t end_l = i, end_r = j;
+
+				while (end_l < len_l && is_digit(str_l[end_l]))
+					++end_l;
+				while (end_r < len_r && is_digit(str_r[end_r]))
+					++end_r;
+
+				// the run with more significant digits is the greater number, otherwise the first differing digit decides.
+				if ((end_l - i) != (end_r - j))
+					return ((end_l - i) < (end_r - j)) ? -1 : 1;
+
+				for (; i < end_l; ++i, ++j)
+				{
+					if (str_l[i] != str_r[j])
+						return (str_l[i] < str_r[j]) ? -1 : 1;
+				}
+
+				if (zeroes_cmp == 0 && (end_l - start_l) != (end_r - start_r))
+					zeroes_cmp = ((end_l - start_l) < (end_r - start_r)) ? -1 : 1;
+
+				j = end_r;
+
+				continue;
+			}
+
+			unsigned char c_l = static_cast<unsigned char>(str_l[i]), c_r = static_cast<unsigned char>(str_r[j]);
+
+			if (!case_sensitive)
+			{
+				c_l = fold_case(c_l);
+				c_r = fold_case(c_r);
+			}
+
+			if (c_l != c_r)
+				return (c_l < c_r) ? -1 : 1;
+
+			++i;
+			++j;
+		}
+
+		if (i < len_l)
+			return 1;
+		if (j < len_r)
+			return -1;
+
+		return zeroes_cmp;
+	}
+	// returns an integer indicating the result of performing a (by default, case-sensitive) comparison between the character sequences of two strings (extended strings, STL strings or character arrays, in any combination) in natural ("human") order. See the string view version of (natural_compare) for details.
+	template<class Str_l, class Str_r> static int natural_compare(const Str_l& str_l, const Str_r& str_r, const bool case_sensitive = true) noexcept
+	{
+		return natural_compare(view_of(str_l), view_of(str_r), case_sensitive);
+	}
+
+	// A function object that returns whether a given string (an extended string, an STL string, a string view or a character array) precedes another in natural ("human") order. Comparisons are case-sensitive unless (case_sensitive) is set to false. Useful as the comparator of STL algorithms and containers.
+	struct natural_less
+	{
+		bool case_sensitive = true;
+
+		template<class Str_l, class Str_r> bool operator()(const Str_l& str_l, const Str_r& str_r) const noexcept
+		{
+			return natural_compare(view_of(str_l), view_of(str_r), case_sensitive) < 0;
+		}
+	};
+
+private:
+	/*
+	A string prepared for computing its edit distance to other strings with the bit-parallel algorithm of Myers (as extended to global distances and to strings longer than a machine word by Hyyrö).
+
+	the string is split into blocks of 64 characters, and for each possible character and each block, a 64-bit mask marks the positions of the block where the character occurs. A column of the dynamic programming matrix is then represented by two bit vectors per block, marking the cells that are one more (pv) and one less (mv) than the cell above them, and each character of the other string advances all of them with a handful of bitwise operations.
+	*/
+	class myers_pattern
+	{
+		size_t len = 0, n_blocks = 0;
+		// the match masks, with the masks of all the blocks for a given character being contiguous.
+		std::vector<std::uint64_t> peq = {};
+
+	public:
+		explicit myers_pattern(const std::string_view pattern) : len(pattern.length()), n_blocks((pattern.length() + 63) / 64), peq(256 * n_blocks, 0)
+		{
+			for (size_t i = 0; i < len; ++i)
+				peq[static_cast<unsigned char>(pattern[i]) * n_blocks + i / 64] |= std::uint64_t(1) << (i % 64);
+		}
+
+		// returns the edit distance between the pattern and a given text, or (max_distance + 1) as soon as the distance is known to be greater than a given maximum.
+		size_t distance(const std::string_view text, const size_t max_distance) const
+		{
+			const size_t text_len = text.length();
+			const size_t len_diff = (len > text_len) ? (len - text_len) : (text_len - len);
+
+			if (len_diff > max_distance)
+				return max_distance + 1;
+			if (len == 0)
+				return text_len;
+
+			const unsigned last_bit = static_cast<unsigned>((len - 1) % 64);
+			size_t score = len;
+
+			if (n_blocks == 1)
+			{
+				std::uint64_t pv = ~std::uint64_t(0), mv = 0;
+
+				for (size_t j = 0; j < text_len; ++j)
+				{
+					std::uint64_t eq = peq[static_cast<unsigned char>(text[j])];
+
+					const std::uint64_t xv = eq | mv;
+					const std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+
+					std::uint64_t ph = mv | ~(xh | pv), mh = pv & xh;
+
+					score += (ph >> last_bit) & 1;
+					score -= (mh >> last_bit) & 1;
+
+					// the first row of the matrix grows by one with every column (the global distance).
+					ph = (ph << 1) | 1;
+					mh <<= 1;
+
+					pv = mh | ~(xv | ph);
+					mv = ph & xv;
+
+					// the distance cannot decrease by more than one per remaining column.
+					if (score > max_distance && score - max_distance > text_len - j - 1)
+						return max_distance + 1;
+				}
+
+				return score;
+			}
+
+			std::vector<std::uint64_t> pv(n_blocks, ~std::uint64_t(0)), mv(n_blocks, 0);
+
+			for (size_t j = 0; j < text_len; ++j)
+			{
+				const std::uint64_t* const eqs = peq.data() + static_cast<unsigned char>(text[j]) * n_blocks;
+
+				// the horizontal difference entering the current block from above (+1, 0 or -1).
+				int h_in = 1;
+
+				for (size_t b = 0; b < n_blocks; ++b)
+				{
+					const std::uint64_t h_in_neg = (h_in < 0) ? 1 : 0, h_in_pos = (h_in > 0) ? 1 : 0;
+
+					std::uint64_t eq = eqs[b];
+
+					const std::uint64_t xv = eq | mv[b];
+					eq |= h_in_neg;
+
+					const std::uint64_t xh = (((eq & pv[b]) + pv[b]) ^ pv[b]) | eq;
+
+					std::uint64_t ph = mv[b] | ~(xh | pv[b]), mh = pv[b] & xh;
+
+					if (b == n_blocks - 1)
+					{
+						score += (ph >> last_bit) & 1;
+						score -= (mh >> last_bit) & 1;
+					}
+
+					h_in = static_cast<int>(ph >> 63) - static_cast<int>(mh >> 63);
+
+					ph = (ph << 1) | h_in_pos;
+					mh = (mh << 1) | h_in_neg;
+
+					pv[b] = mh | ~(xv | ph);
+					mv[b] = ph & xv;
+				}
+
+				if (score > max_distance && score - max_distance > text_len - j - 1)
+					return max_distance + 1;
+			}
+
+			return score;
+		}
+	};
+
+public:
+	// returns the edit (Levenshtein) distance between two given character sequences: the least number of single-character insertions, deletions and substitutions that turn one into the other. It is computed by a bit-parallel algorithm that processes 64 cells of the distance matrix at a time. If a maximum distance is given, the computation stops as soon as the distance is known to be greater than it, in which case (max_distance + 1) is returned.
+	static size_t edit_distance(const std::string_view str_l, const std::string_view str_r, const size_t max_distance = std::string::npos)
+	{
+		// the shorter string has fewer blocks, so it makes for the cheaper pattern.
+		if (str_l.length() < str_r.length())
+			return myers_pattern(str_l).distance(str_r, max_distance);
+
+		return myers_pattern(str_r).distance(str_l, max_distance);
+	}
+	// returns the edit (Levenshtein) distance between this extended string and another. If a maximum distance is given, the computation stops as soon as the distance is known to be greater than it, in which case (max_distance + 1) is returned.
+	size_t edit_distance(const str& other, const size_t max_distance = std::string::npos) const
+	{
+		return edit_distance(std::string_view(_str), std::string_view(other._str), max_distance);
+	}
+
+	// A match found by a fuzzy search: the offset of a string in the searched collection and its edit distance from the query.
+	struct fuzzy_match
+	{
+		size_t index;
+		size_t distance;
+	};
+
+	/*
+	returns the (at most) k strings of a given C++ STL container (of extended strings, STL strings, string views or character arrays) that are closest to a given query in edit (Levenshtein) distance, ordered by distance and then by their offsets in the container. Strings farther than a given maximum distance from the query are not returned.
+
+	the query is prepared once, and the container is split into chunks that are scored in parallel by a given number of threads (the number of hardware threads by default). Each chunk keeps its own k best matches, and the distance of the worst of them serves as the maximum distance for the rest of the chunk, so most strings are abandoned after a few characters.
+	*/
+	template<class Cont> static std::vector<fuzzy_match> fuzzy_search(const std::string_view query, const Cont& dictionary, const size_t k, const size_t max_distance = std::string::npos, const size_t n_threads = 0)
+	{
+		const auto first = std::begin(dictionary);
+		const size_t n = static_cast<size_t>(std::end(dictionary) - first);
+
+		if (k == 0 || n == 0)
+			return {};
+
+		const myers_pattern pattern(query);
+
+		const auto closer = [](const fuzzy_match& match_l, const fuzzy_match& match_r)
+		{
+			return (match_l.distance != match_r.distance) ? (match_l.distance < match_r.distance) : (match_l.index < match_r.index);
+		};
+
+		constexpr size_t chunk_len = 4096;
+		const size_t n_chunks = (n + chunk_len - 1) / chunk_len;
+
+		std::vector<std::vector<fuzzy_match>> chunk_matches(n_chunks);
+
+		parallel_for(n_chunks, [&](const size_t c)
+		{
+			// a max-heap of the k best matches of the chunk, whose top is the worst of them.
+			std::vector<fuzzy_match>& matches = chunk_matches[c];
+			matches.reserve(k + 1);
+
+			size_t max_distance_ = max_distance;
+
+			for (size_t i = c * chunk_len; i < std::min(n, (c + 1) * chunk_len); ++i)
+			{
+				const size_t distance = pattern.distance(view_of(first[i]), max_distance_);
+
+				if (distance > max_distance_)
+					continue;
+
+				matches.push_back({ i, distance });
+				std::push_heap(matches.begin(), matches.end(), closer);
+
+				if (matches.size() > k)
+				{
+					std::pop_heap(matches.begin(), matches.end(), closer);
+					matches.pop_back();
+				}
+
+				if (matches.size() == k)
+					max_distance_ = matches.front().distance;
+			}
+		}, n_threads);
+
+		std::vector<fuzzy_match> matches = {};
+
+		for (const std::vector<fuzzy_match>& chunk_matches_ : chunk_matches)
+			matches.insert(matches.end(), chunk_matches_.begin(), chunk_matches_.end());
+
+		std::sort(matches.begin(), matches.end(), closer);
+
+		if (matches.size() > k)
+			matches.resize(k);
+
+		return matches;
+	}
+
+	// TODO: document comparison operators.
+	
+	friend bool operator==(const str&, const str&) noexcept;
+	friend bool operator==(const str&, const std::string&);
+	friend bool operator==(const str&, const char*);
+	friend bool operator==(const std::string&, const str&);
+	friend bool operator==(const char*, const str&);
+	
+	friend bool operator!=(const str&, const str&) noexcept;
+	friend bool operator!=(const str&, const std::string&);
+	friend bool operator!=(const str&, const char*);
+	friend bool operator!=(const std::string&, const str&);
+	friend bool operator!=(const char*, const str&);
+
+	friend bool operator<(const str&, const str&) noexcept;
+	friend bool operator<(const str&, const std::string&);
+	friend bool operator<(const str&, const char*);
+	friend bool operator<(const std::string&, const str&);
+	friend bool operator<(const char*, const str&);
+	
+	friend bool operator<=(const str&, const str&) noexcept;
+	friend bool operator<=(const str&, const std::string&);
+	friend bool operator<=(const str&, const char*);
+	friend bool operator<=(const std::string&, const str&);
+	friend bool operator<=(const char*, const str&);
+	
+	friend bool operator>(const str&, const str&) noexcept;
+	friend bool operator>(const str&, const std::string&);
+	friend bool operator>(const str&, const char*);
+	friend bool operator>(const std::string&, const str&);
+	friend bool operator>(const std::string&, const char*);
+	friend bool operator>(const char*, const str&);
+
+	friend bool operator>=(const str&, const str&) noexcept;
+	friend bool operator>=(const str&, const std::string&);
+	friend bool operator>=(const str&, const char*);
+	friend bool operator>=(const std::string&, const str&);
+	friend bool operator>=(const std::string&, const char*);
+	friend bool operator>=(const char*, const str&);
+
+	// returns this extended string that is the result of concatenating two given extended strings.
+	friend str operator+(const str&, const str&);
+	// returns this extended string that is the result of concatenating an extended string with an STL string.
+	friend str operator+(const str&, const std::string&);
+	// returns this extended string that is the result of concatenating an STL string with an extended string.
+	friend str operator+(const std::string&, const str&);
+	// returns this extended string that is the result of concatenating an extended string with a character array.
+	friend str operator+(const str&, const char*);
+	// returns this extended string that is the result of concatenating a character array with an extended string.
+	friend str operator+(const char*, const str&);
+	// returns this extended string that is the result of concatenating an extended string with a character.
+	friend str operator+(const str&, char);
+	// returns this extended string that is the result of concatenating a character array with an extended string.
+	friend str operator+(char, const str&);
+
+	/*
+	extracts characters from a given input stream and stores them into this extended string until a given character (a newline character, by default) is encountered (which will not be stored), or until the end-of-file (EOF) is encountered - whichever comes first.
+	the content of this extended string before the call, if any, is replaced.
+	
+	The function returns the input stream from which characters were extracted.
+	*/
+	std::istream& getline(std::istream& input_stream, const char& delim = '\n')
+	{
+		return std::getline(input_stream, _str, delim);
+	}
+	/*
+	extracts characters from a given input stream and stores them into a given extended string until a given character (a newline character, by default) is encountered (which will not be stored), or until the end-of-file (EOF) is encountered - whichever comes first.
+
+	The function returns the input stream from which extraction has occurred.
+	*/
+	static std::istream& getline(std::istream& input_stream, str& str_, const char& delim = '\n')
+	{
+		return std::getline(input_stream, str_._str, delim);
+	}
+
+private:
+	// A file opened through the interface of the operating system (a handle on Windows and a file descriptor elsewhere), which is closed on destruction.
+	class native_file
+	{
+#if defined(_WIN32)
+		HANDLE handle = INVALID_HANDLE_VALUE;
+#else
+		int fd = -1;
+#endif
+
+	public:
+		native_file() = default;
+		native_file(const native_file&) = delete;
+		native_file(native_file&& other) noexcept
+		{
+			swap(other);
+		}
+		native_file& operator=(const native_file&) = delete;
+		native_file& operator=(native_file&& other) noexcept
+		{
+			swap(other);
+
+			return *this;
+		}
+		~native_file()
+		{
+			close();
+		}
+
+		// swaps the files of this native file and another.
+		void swap(native_file& other) noexcept
+		{
+#if defined(_WIN32)
+			std::swap(handle, other.handle);
+#else
+			std::swap(fd, other.fd);
+#endif
+		}
+
+		// opens a given file for reading, and returns whether it succeeded.
+		bool open_read(const std::string& path) noexcept
+		{
+			close();
+
+#if defined(_WIN32)
+			handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+#else
+			fd = ::open(path.c_str(), O_RDONLY);
+#endif
+
+			return is_open();
+		}
+		// opens (creating it if needed) a given file for writing, either appending to it or truncating it, and returns whether it succeeded.
+		bool open_write(const std::string& path, const bool append) noexcept
+		{
+			close();
+
+#if defined(_WIN32)
+			handle = CreateFileA(path.c_str(), append ? FILE_APPEND_DATA : GENERIC_WRITE, FILE_SHARE_READ, nullptr, append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+			fd = ::open(path.c_str(), O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC), 0644);
+#endif
+
+			return is_open();
+		}
+		// opens the standard output (duplicating its handle or file descriptor, so that it is not closed along with this native file), and returns whether it succeeded.
+		bool open_standard_output() noexcept
+		{
+			close();
+
+#if defined(_WIN32)
+			if (!DuplicateHandle(GetCurrentProcess(), GetStdHandle(STD_OUTPUT_HANDLE), GetCurrentProcess(), &handle, 0, FALSE, DUPLICATE_SAME_ACCESS))
+				handle = INVALID_HANDLE_VALUE;
+#else
+			fd = ::dup(STDOUT_FILENO);
+#endif
+
+			return is_open();
+		}
+
+		// returns whether this native file is open.
+		bool is_open() const noexcept
+		{
+#if defined(_WIN32)
+			return handle != INVALID_HANDLE_VALUE;
+#else
+			return fd != -1;
+#endif
+		}
+
+		// closes this native file, if it is open.
+		void close() noexcept
+		{
+			if (!is_open())
+				return;
+
+#if defined(_WIN32)
+			CloseHandle(handle);
+			handle = INVALID_HANDLE_VALUE;
+#else
+			::close(fd);
+			fd = -1;
+#endif
+		}
+
+		// reads up to a given number of bytes from this native file into a given buffer, and returns the number of bytes read, which is zero at the end of the file or on failure.
+		size_t read(char* buffer, const size_t n) noexcept
+		{
+#if defined(_WIN32)
+			DWORD n_read = 0;
+
+			if (!ReadFile(handle, buffer, static_cast<DWORD>(std::min<size_t>(n, 1u << 30)), &n_read, nullptr))
+				return 0;
+
+			return n_read;
+#else
+			for (;;)
+			{
+				const ssize_t n_read = ::read(fd, buffer, n);
+
+				if (n_read >= 0)
+					return static_cast<size_t>(n_read);
+				if (errno != EINTR)
+					return 0;
+			}
+#endif
+		}
+
+		// writes given character sequences, in order, to this native file in as few system calls as possible (one (writev) call per 16 sequences unless the system writes partially), and returns whether all of them were written.
+		bool write(const std::string_view* pieces, const size_t n_pieces) noexcept
+		{
+#if defined(_WIN32)
+			for (size_t i = 0; i < n_pieces; ++i)
+			{
+				const char* chars = pieces[i].data();
+				size_t n_left = pieces[i].length();
+
+				while (n_left != 0)
+				{
+					DWORD n_written = 0;
+
+					if (!WriteFile(handle, chars, static_cast<DWORD>(std::min<size_t>(n_left, 1u << 30)), &n_written, nullptr))
+						return false;
+
+					chars += n_written;
+					n_left -= n_written;
+				}
+			}
+#else
+			for (size_t i = 0; i < n_pieces; )
+			{
+				iovec vecs[16];
+				int n_vecs = 0;
+
+				for (; i < n_pieces && n_vecs < 16; ++i)
+					if (!pieces[i].empty())
+						vecs[n_vecs++] = { const_cast<char*>(pieces[i].data()), pieces[i].length() };
+
+				for (iovec* vec = vecs; vec != vecs + n_vecs; )
+				{
+					const ssize_t n_written = ::writev(fd, vec, static_cast<int>(vecs + n_vecs - vec));
+
+					if (n_written < 0)
+					{
+						if (errno == EINTR)
+							continue;
+
+						return false;
+					}
+
+					size_t n_left = static_cast<size_t>(n_written);
+
+					for (; vec != vecs + n_vecs && n_left >= vec->iov_len; ++vec)
+						n_left -= vec->iov_len;
+
+					if (vec != vecs + n_vecs)
+					{
+						vec->iov_base = static_cast<char*>(vec->iov_base) + n_left;
+						vec->iov_len -= n_left;
+					}
+				}
+			}
+#endif
+
+			return true;
+		}
+
+		// gets the size of this native file in bytes, and returns whether it is a regular file (whose size is known).
+		bool size(size_t& size_) const noexcept
+		{
+#if defined(_WIN32)
+			LARGE_INTEGER size_l = { };
+
+			if (GetFileType(handle) != FILE_TYPE_DISK || !GetFileSizeEx(handle, &size_l))
+				return false;
+
+			size_ = static_cast<size_t>(size_l.QuadPart);
+#else
+			struct stat status = { };
+
+			if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode))
+				return false;
+
+			size_ = static_cast<size_t>(status.st_size);
+#endif
+
+			return true;
+		}
+
+		// returns the handle (on Windows) or the file descriptor (elsewhere) of this native file.
+#if defined(_WIN32)
+		HANDLE native_handle() const noexcept
+		{
+			return handle;
+		}
+#else
+		int native_handle() const noexcept
+		{
+			return fd;
+		}
+#endif
+	};
+
+	// A read-only mapping of the whole content of a file into memory, which is unmapped on destruction.
+	class file_mapping
+	{
+		const char* data = nullptr;
+		size_t len = 0;
+#if defined(_WIN32)
+		HANDLE mapping = nullptr;
+#endif
+
+	public:
+		file_mapping() = default;
+		file_mapping(const file_mapping&) = delete;
+		file_mapping(file_mapping&& other) noexcept
+		{
+			swap(other);
+		}
+		file_mapping& operator=(const file_mapping&) = delete;
+		file_mapping& operator=(file_mapping&& other) noexcept
+		{
+			swap(other);
+
+			return *this;
+		}
+		~file_mapping()
+		{
+			unmap();
+		}
+
+		// swaps the mappings of this file mapping and another.
+		void swap(file_mapping& other) noexcept
+		{
+			std::swap(data, other.data);
+			std::swap(len, other.len);
+#if defined(_WIN32)
+			std::swap(mapping, other.mapping);
+#endif
+		}
+
+		// maps the first given number of bytes of a given open file into memory (advising the system that they will be read sequentially), and returns whether it succeeded. Empty files cannot be mapped.
+		bool map(const native_file& file, const size_t len_) noexcept
+		{
+			unmap();
+
+			if (len_ == 0)
+				return false;
+
+#if defined(_WIN32)
+			mapping = CreateFileMappingA(file.native_handle(), nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+			if (mapping == nullptr)
+				return false;
+
+			data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, len_));
+
+			if (data == nullptr)
+			{
+				CloseHandle(mapping);
+				mapping = nullptr;
+
+				return false;
+			}
+#else
+			void* const data_ = ::mmap(nullptr, len_, PROT_READ, MAP_PRIVATE, file.native_handle(), 0);
+
+			if (data_ == MAP_FAILED)
+				return false;
+
+			::madvise(data_, len_, MADV_SEQUENTIAL);
+
+			data = static_cast<const char*>(data_);
+#endif
+
+			len = len_;
+
+			return true;
+		}
+
+		// unmaps the mapped file, if any.
+		void unmap() noexcept
+		{
+			if (data == nullptr)
+				return;
+
+#if defined(_WIN32)
+			UnmapViewOfFile(data);
+			CloseHandle(mapping);
+			mapping = nullptr;
+#else
+			::munmap(const_cast<char*>(data), len);
+#endif
+
+			data = nullptr;
+			len = 0;
+		}
+
+		// returns whether a file is mapped.
+		bool is_mapped() const noexcept
+		{
+			return data != nullptr;
+		}
+		// returns a view of the mapped content.
+		std::string_view view() const noexcept
+		{
+			return { data, len };
+		}
+	};
+
+public:
+	/*
+	A reader of the lines of a file, meant for high-throughput ingestion.
+
+	the file is mapped into memory where possible, and each line is returned as a view of the mapping, so no character is copied. Files that cannot be mapped (such as pipes and devices) are read in large blocks (of 1 MiB by default), always reading a whole block so that reads stay aligned to the block size, and each line is returned as a view of the block buffer. Newlines are located with (memchr), which the standard libraries implement with vector instructions.
+
+	lines are delimited by line feeds, and a carriage return preceding a line feed (as in CRLF line endings) is not part of the line. A last line not followed by a line feed is returned as well. The line number and the offset (in bytes, from the beginning of the file) of the last line read are available.
+	*/
+	class line_reader
+	{
+		native_file file = {};
+		file_mapping mapping = {};
+
+		// the buffer used when the file is not mapped, and its block size.
+		std::vector<char> buffer = {};
+		size_t block_size = 0;
+
+		// the characters not yet consumed (in the mapping or in the buffer), and the number of them known not to contain a line feed.
+		const char* pos = nullptr;
+		const char* end = nullptr;
+		size_t scanned = 0;
+		bool at_eof = false;
+
+		size_t line_number_ = 0, offset_ = 0, next_offset = 0;
+
+		// moves the characters not yet consumed to the front of the buffer, reads the next block of the file after them, and returns whether any character was read.
+		bool read_block()
+		{
+			const size_t remaining = static_cast<size_t>(end - pos);
+
+			if (remaining != 0)
+				std::memmove(buffer.data(), pos, remaining);
+
+			if (buffer.size() < remaining + block_size)
+				buffer.resize(remaining + block_size);
+
+			const size_t n_read = file.read(buffer.data() + remaining, block_size);
+
+			pos = buffer.data();
+			end = pos + remaining + n_read;
+			at_eof = (n_read == 0);
+
+			return n_read != 0;
+		}
+
+	public:
+		// opens a given file for reading its lines, mapping it into memory if possible, and otherwise reading it in blocks of a given size (1 MiB by default). Whether the file was opened can be checked with (is_open).
+		explicit line_reader(const std::string& path, const size_t block_size_ = 1 << 20) : block_size(std::max<size_t>(block_size_, 1))
+		{
+			size_t size = 0;
+
+			if (file.open_read(path) && file.size(size) && mapping.map(file, size))
+			{
+				pos = mapping.view().data();
+				end = pos + size;
+				at_eof = true;
+			}
+		}
+
+		// returns whether the file was opened.
+		bool is_open() const noexcept
+		{
+			return file.is_open();
+		}
+		// returns whether the file is mapped into memory (rather than being read in blocks).
+		bool is_mapped() const noexcept
+		{
+			return mapping.is_mapped();
+		}
+
+		// reads the next line into a given view, and returns whether there was a line to read. The view is valid until the next line is read if the file is read in blocks, and as long as this line reader exists if the file is mapped.
+		bool next(std::string_view& line)
+		{
+			for (;;)
+			{
+				const char* const newline = (pos + scanned == end) ? nullptr : static_cast<const char*>(std::memchr(pos + scanned, '\n', static_cast<size_t>(end - pos) - scanned));
+
+				if (newline != nullptr)
+				{
+					line = { pos, static_cast<size_t>(newline - pos) };
+					pos = newline + 1;
+
+					break;
+				}
+
+				scanned = static_cast<size_t>(end - pos);
+
+				if (!at_eof && (read_block() || pos != end))
+					continue;
+
+				if (pos == end)
+					return false;
+
+				line = { pos, static_cast<size_t>(end - pos) };
+				pos = end;
+
+				break;
+			}
+
+			offset_ = next_offset;
+			next_offset += static_cast<size_t>(pos - line.data());
+			scanned = 0;
+			++line_number_;
+
+			if (!line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+
+			return true;
+		}
+
+		// returns the number of the last line read (starting from 1), or zero if no line was read.
+		size_t line_number() const noexcept
+		{
+			return line_number_;
+		}
+		// returns the offset (in bytes, from the beginning of the file) of the last line read.
+		size_t offset() const noexcept
+		{
+			return offset_;
+		}
+	};
+
+	/*
+	A writer of lines to a file, which keeps the file open and buffers the lines, meant for writing many lines (such as logs and reports) cheaply.
+
+	the file is either truncated (by default) or appended to. Lines are buffered (in a buffer of 1 MiB by default) and written in batches with a single (writev) call, along with any line too long to fit in the buffer, which is never copied. The buffer is written when it is full, when this line writer is flushed or destroyed, and as dictated by its flush policy: never (the default), every given number of lines, or once a given number of bytes is buffered.
+
+	whether the file was opened can be checked with (is_open), and whether every write succeeded with (good).
+	*/
+	class line_writer
+	{
+	public:
+		// the policies for flushing buffered lines to the file, in addition to flushing when the buffer is full.
+		enum flush_policy : std::int8_t { never = 0, every_n_lines = 1, byte_threshold = 2 };
+
+	private:
+		native_file file = {};
+		std::vector<char> buffer = {};
+		size_t used = 0;
+
+		flush_policy policy = never;
+		size_t threshold = 0;
+		size_t pending_lines = 0;
+		bool failed = false;
+
+		// writes the buffered characters followed by a given line and newline to the file in a single batch, and empties the buffer.
+		void write_through(const std::string_view line = {}, const std::string_view newline = {})
+		{
+			const std::string_view pieces[] = { { buffer.data(), used }, line, newline };
+
+			if (!file.write(pieces, 3))
+				failed = true;
+
+			used = 0;
+			pending_lines = 0;
+		}
+
+	public:
+		line_writer() = default;
+		// opens (creating it if needed) a given file for writing lines, either truncating it (by default) or appending to it, with a given flush policy, its threshold (a number of lines or of bytes), and a given buffer size (1 MiB by default).
+		explicit line_writer(const std::string& path, const bool append = false, const flush_policy policy_ = never, const size_t threshold_ = 0, const size_t buffer_size = 1 << 20) : buffer(std::max<size_t>(buffer_size, 1)), policy(policy_), threshold(threshold_)
+		{
+			file.open_write(path, append);
+		}
+		line_writer(const line_writer&) = delete;
+		line_writer(line_writer&& other) noexcept
+		{
+			swap(other);
+		}
+		line_writer& operator=(const line_writer&) = delete;
+		line_writer& operator=(line_writer&& other) noexcept
+		{
+			line_writer(std::move(other)).swap(*this);
+
+			return *this;
+		}
+		~line_writer()
+		{
+			flush();
+		}
+
+		// swaps the files, buffers and flush policies of this line writer and another.
+		void swap(line_writer& other) noexcept
+		{
+			file.swap(other.file);
+			buffer.swap(other.buffer);
+			std::swap(used, other.used);
+			std::swap(policy, other.policy);
+			std::swap(threshold, other.threshold);
+			std::swap(pending_lines, other.pending_lines);
+			std::swap(failed, other.failed);
+		}
+
+		// returns whether the file was opened.
+		bool is_open() const noexcept
+		{
+			return file.is_open();
+		}
+		// returns whether the file was opened and every write to it succeeded.
+		bool good() const noexcept
+		{
+			return is_open() && !failed;
+		}
+
+		// writes a given line followed by a newline, and returns whether this line writer is still good.
+		bool write_line(const std::string_view line)
+		{
+			if (!is_open())
+				return false;
+
+			if (buffer.size() - used > line.length())
+			{
+				std::memcpy(buffer.data() + used, line.data(), line.length());
+				used += line.length();
+				buffer[used++] = '\n';
+			}
+			else
+				write_through(line, "\n");
+
+			++pending_lines;
+
+			if ((policy == every_n_lines && pending_lines >= threshold) || (policy == byte_threshold && used >= threshold))
+				flush();
+
+			return good();
+		}
+
+		// writes the buffered lines to the file, and returns whether this line writer is still good.
+		bool flush()
+		{
+			if (used != 0)
+				write_through();
+
+			pending_lines = 0;
+
+			return good();
+		}
+	};
+
+	/*
+	An asynchronous sink of lines, meant for writing logs from latency-sensitive threads.
+
+	the sink allocates a pool of lock-free ring buffers (one per hardware thread by default, of 1 MiB each by default) when it is constructed. Each thread writing to the sink claims one of them on its first write, with a single atomic compare-and-swap, and releases it when it exits, so that a thread created later can claim it. Writing a line merely copies it into the buffer of the thread and publishes its end, so writing threads never take a lock, allocate or make a system call (unless they wait for space, see below). A background thread drains all the buffers, writing every line they hold directly from them in a single (writev) call. When they are empty, it looks at them again after a wait that doubles from 64 microseconds up to 16 milliseconds for as long as they stay empty, so that writing threads never have to wake it and an idle sink wakes at most about 60 times a second.
+
+	memory is bounded by the buffer size times the number of buffers. When the buffer of a thread is full, a line is either dropped (by default) or written once the background thread has made space for it (which blocks the writing thread), as dictated by the overflow policy. A line longer than the buffer, or written by a thread that found every buffer of the pool claimed by other threads (the pool should be as large as the number of writing threads), is dropped under the dropping policy, and handed over to the background thread under a lock under the blocking policy (the writing thread waiting until it is written). The number of dropped lines is available.
+
+	lines of a single thread are written in order, while lines of different threads may be interleaved (but never mixed). On destruction, or when the sink is closed, every buffered line is written. Writing a line must not race with closing the sink. Lines written to the standard output bypass the buffer of (std::cout), which should be flushed beforehand if used.
+	*/
+	class async_sink
+	{
+	public:
+		// the policies for a line written to a full buffer: dropping it, or blocking until there is space for it.
+		enum overflow_policy : std::int8_t { drop = 0, block = 1 };
+
+	private:
+		// a single-producer single-consumer ring buffer of characters, whose capacity is a power of two, owned by the thread that claimed it (none until then). The head is advanced by the owner and the tail by the background thread.
+		struct ring
+		{
+			std::unique_ptr<char[]> chars;
+			size_t capacity;
+			std::atomic<std::thread::id> owner = { std::thread::id() };
+
+			alignas(64) std::atomic<size_t> head = { 0 };
+			size_t cached_tail = 0;
+			alignas(64) std::atomic<size_t> tail = { 0 };
+
+			explicit ring(const size_t capacity_) : chars(new char[capacity_]), capacity(capacity_) { }
+		};
+
+		// The buffers claimed by a thread, each with the identifier of its sink (so that the thread finds its buffer without reading the pool), which are released when the thread exits, unless their sinks were destroyed first. The buffers of up to 8 sinks are held this way at once; a buffer claimed beyond them is found in the pool by its owner, and is released only with its sink.
+		struct thread_claims
+		{
+			struct claim
+			{
+				size_t sink_id = 0;
+				ring* ring_ = nullptr;
+				std::weak_ptr<ring> alive = {};
+			};
+
+			std::array<claim, 8> claims = {};
+
+			~thread_claims()
+			{
+				for (const claim& claim_ : claims)
+					if (const std::shared_ptr<ring> ring_ = claim_.alive.lock())
+						ring_->owner.store(std::thread::id(), std::memory_order_release);
+			}
+		};
+
+		static constexpr std::chrono::microseconds min_idle_wait = std::chrono::microseconds(64), max_idle_wait = std::chrono::milliseconds(16);
+
+		native_file file = {};
+		overflow_policy policy = drop;
+		size_t ring_size = 0;
+		size_t id = 0;
+
+		std::vector<std::shared_ptr<ring>> rings = {};
+
+		std::mutex handoff_mutex = {};
+		std::atomic<const std::string_view*> handoff = { nullptr };
+
+		std::atomic<size_t> n_dropped = { 0 };
+		std::atomic<bool> stopping = { false };
+		bool opened = false, failed = false;
+		std::mutex wake_mutex = {};
+		std::condition_variable wake = {};
+		std::thread drainer = {};
+
+		// returns a new identifier, distinguishing a sink from those that previously existed at the same address.
+		static size_t next_id() noexcept
+		{
+			static std::atomic<size_t> last_id = { 0 };
+
+			return ++last_id;
+		}
+
+		// returns the buffer of the calling thread, which claims a free one of the pool on its first call, or null if every buffer is claimed by other threads. Finding or claiming a buffer only reads the claims of the thread and the owners of the buffers, so no call takes a lock or allocates.
+		ring* thread_ring() noexcept
+		{
+			static thread_local thread_claims claims_ = {};
+
+			for (const thread_claims::claim& claim_ : claims_.claims)
+				if (claim_.sink_id == id)
+					return claim_.ring_;
+
+			const std::thread::id thread_id = std::this_thread::get_id();
+			const std::shared_ptr<ring>* ring_ = nullptr;
+
+			for (const std::shared_ptr<ring>& ring__ : rings)
+				if (ring__->owner.load(std::memory_order_relaxed) == thread_id)
+				{
+					ring_ = &ring__;
+					break;
+				}
+
+			for (size_t i = 0; ring_ == nullptr && i < rings.size(); ++i)
+			{
+				std::thread::id none = std::thread::id();
+
+				if (rings[i]->owner.compare_exchange_strong(none, thread_id, std::memory_order_acquire))
+					ring_ = &rings[i];
+			}
+
+			if (ring_ == nullptr)
+				return nullptr;
+
+			// the claim takes the place of one whose sink was destroyed (or of an unused one), if any.
+			for (thread_claims::claim& claim_ : claims_.claims)
+				if (claim_.alive.expired())
+				{
+					claim_ = { id, ring_->get(), *ring_ };
+					break;
+				}
+
+			return ring_->get();
+		}
+
+		// hands a given line over to the background thread, which writes it after every line buffered so far, and waits until it is written. Meant for the lines that cannot be buffered under the blocking policy.
+		void hand_over(const std::string_view line)
+		{
+			std::lock_guard<std::mutex> lock(handoff_mutex);
+
+			handoff.store(&line, std::memory_order_release);
+
+			while (handoff.load(std::memory_order_acquire) != nullptr)
+				std::this_thread::yield();
+		}
+
+		// writes the lines buffered by every thread (and those handed over) until the sink is closed and the buffers are empty.
+		void drain()
+		{
+			std::vector<size_t> heads(rings.size());
+			std::vector<std::string_view> pieces = {};
+			std::chrono::microseconds idle_wait = min_idle_wait;
+
+			for (;;)
+			{
+				const bool stopping_ = stopping.load(std::memory_order_acquire);
+
+				// the line handed over is loaded before the heads, so that the lines buffered by its thread before it are written first.
+				const std::string_view* const line = handoff.load(std::memory_order_acquire);
+
+				pieces.clear();
+
+				for (size_t i = 0; i < rings.size(); ++i)
+				{
+					const ring& ring_ = *rings[i];
+					const size_t tail = ring_.tail.load(std::memory_order_relaxed);
+
+					heads[i] = ring_.head.load(std::memory_order_acquire);
+
+					if (heads[i] == tail)
+						continue;
+
+					const size_t first = tail & (ring_.capacity - 1), n = heads[i] - tail;
+					const size_t n_before_wrap = std::min(n, ring_.capacity - first);
+
+					pieces.emplace_back(ring_.chars.get() + first, n_before_wrap);
+
+					if (n_before_wrap != n)
+						pieces.emplace_back(ring_.chars.get(), n - n_before_wrap);
+				}
+
+				if (line != nullptr)
+				{
+					pieces.push_back(*line);
+					pieces.emplace_back("\n", 1);
+				}
+
+				if (!pieces.empty())
+				{
+					if (!file.write(pieces.data(), pieces.size()))
+						failed = true;
+
+					for (size_t i = 0; i < rings.size(); ++i)
+						rings[i]->tail.store(heads[i], std::memory_order_release);
+
+					if (line != nullptr)
+						handoff.store(nullptr, std::memory_order_release);
+
+					idle_wait = min_idle_wait;
+				}
+				else if (stopping_)
+					break;
+				else
+				{
+					std::unique_lock<std::mutex> lock(wake_mutex);
+
+					wake.wait_for(lock, idle_wait, [this] { return stopping.load(std::memory_order_acquire); });
+					idle_wait = std::min(idle_wait * 2, std::chrono::microseconds(max_idle_wait));
+				}
+			}
+		}
+
+		// allocates the pool of buffers and starts the background thread, if the file was opened.
+		void start(const overflow_policy policy_, const size_t ring_size_, const size_t n_rings)
+		{
+			policy = policy_;
+			ring_size = 64;
+			id = next_id();
+
+			while (ring_size < ring_size_)
+				ring_size *= 2;
+
+			opened = file.is_open();
+
+			if (opened)
+			{
+				rings.resize(std::max<size_t>(n_rings ? n_rings : std::thread::hardware_concurrency(), 1));
+
+				for (std::shared_ptr<ring>& ring_ : rings)
+					ring_.reset(new ring(ring_size));
+
+				drainer = std::thread(&async_sink::drain, this);
+			}
+		}
+
+	public:
+		// opens (creating it if needed) a given file for writing lines asynchronously, either truncating it (by default) or appending to it, with a given overflow policy, buffer size (1 MiB by default, rounded up to a power of two) and number of buffers (by default, the number of hardware threads).
+		explicit async_sink(const std::string& path, const bool append = false, const overflow_policy policy_ = drop, const size_t ring_size_ = 1 << 20, const size_t n_rings = 0)
+		{
+			file.open_write(path, append);
+			start(policy_, ring_size_, n_rings);
+		}
+		// opens the standard output for writing lines asynchronously, with a given overflow policy, buffer size (1 MiB by default, rounded up to a power of two) and number of buffers (by default, the number of hardware threads).
+		explicit async_sink(const overflow_policy policy_ = drop, const size_t ring_size_ = 1 << 20, const size_t n_rings = 0)
+		{
+			file.open_standard_output();
+			start(policy_, ring_size_, n_rings);
+		}
+		async_sink(const async_sink&) = delete;
+		async_sink& operator=(const async_sink&) = delete;
+		~async_sink()
+		{
+			close();
+		}
+
+		// returns whether the file was opened (and the sink was not closed).
+		bool is_open() const noexcept
+		{
+			return drainer.joinable();
+		}
+		// returns whether the file was opened and every write to it succeeded. Meaningful only once the sink is closed.
+		bool good() const noexcept
+		{
+			return opened && !failed;
+		}
+		// returns the number of lines dropped so far.
+		size_t dropped() const noexcept
+		{
+			return n_dropped.load(std::memory_order_relaxed);
+		}
+
+		// writes a given line followed by a newline asynchronously, and returns whether it was buffered or handed over (rather than dropped).
+		bool write_line(const std::string_view line)
+		{
+			const size_t n = line.length() + 1;
+			ring* const ring_ptr = (!is_open() || n > ring_size) ? nullptr : thread_ring();
+
+			if (ring_ptr == nullptr)
+			{
+				if (is_open() && policy == block)
+				{
+					hand_over(line);
+
+					return true;
+				}
+
+				n_dropped.fetch_add(1, std::memory_order_relaxed);
+
+				return false;
+			}
+
+			ring& ring_ = *ring_ptr;
+			const size_t head = ring_.head.load(std::memory_order_relaxed);
+
+			while (ring_.capacity - (head - ring_.cached_tail) < n)
+			{
+				ring_.cached_tail = ring_.tail.load(std::memory_order_acquire);
+
+				if (ring_.capacity - (head - ring_.cached_tail) >= n)
+					break;
+
+				if (policy == drop)
+				{
+					n_dropped.fetch_add(1, std::memory_order_relaxed);
+
+					return false;
+				}
+
+				std::this_thread::yield();
+			}
+
+			const size_t first = head & (ring_.capacity - 1);
+			const size_t n_before_wrap = std::min(line.length(), ring_.capacity - first);
+
+			std::memcpy(ring_.chars.get() + first, line.data(), n_before_wrap);
+			std::memcpy(ring_.chars.get(), line.data() + n_before_wrap, line.length() - n_before_wrap);
+			ring_.chars[(head + line.length()) & (ring_.capacity - 1)] = '\n';
+
+			ring_.head.store(head + n, std::memory_order_release);
+
+			return true;
+		}
+
+		// writes every buffered line, stops the background thread and closes the file. Must not race with writing a line.
+		void close()
+		{
+			if (!drainer.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(wake_mutex);
+
+				stopping.store(true, std::memory_order_release);
+			}
+
+			wake.notify_one();
+			drainer.join();
+			file.close();
+		}
+	};
+
+	// reads the next line from a given line reader into this extended string (replacing its content), and returns whether there was a line to read. Unlike reading from an input stream, the line is copied only once, from the mapped file or the block buffer of the reader.
+	bool getline(line_reader& reader)
+	{
+		std::string_view line = {};
+
+		if (!reader.next(line))
+			return false;
+
+		_str.assign(line.data(), line.length());
+
+		return true;
+	}
+	// reads the next line from a given line reader into a given extended string (replacing its content), and returns whether there was a line to read.
+	static bool getline(line_reader& reader, str& str_)
+	{
+		return str_.getline(reader);
+	}
+
+private:
+	// The masks of the quotes, delimiters and line feeds among a block of 64 characters of CSV text (bit i being set if character i of the block is one).
+	struct csv_block
+	{
+		std::uint64_t quotes, delims, newlines;
+	};
+
+	// returns the masks of the quotes, delimiters and line feeds among the 64 characters starting at a given position.
+	static csv_block csv_masks(const char* const pos, const char delim, const char quote) noexcept
+	{
+#if defined(STR_AVX2)
+		const __m256i quotes = _mm256_set1_epi8(quote), delims = _mm256_set1_epi8(delim), newlines = _mm256_set1_epi8('\n');
+		const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos)), high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos + 32));
+
+		const auto mask = [&](const __m256i chars)
+		{
+			return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, chars))))
+				| (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, chars)))) << 32);
+		};
+
+		return { mask(quotes), mask(delims), mask(newlines) };
+#elif defined(STR_SSE2)
+		const __m128i quotes = _mm_set1_epi8(quote), delims = _mm_set1_epi8(delim), newlines = _mm_set1_epi8('\n');
+		csv_block block = { 0, 0, 0 };
+
+		for (unsigned i = 0; i < 64; i += 16)
+		{
+			const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos + i));
+
+			block.quotes |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, quotes)))) << i;
+			block.delims |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, delims)))) << i;
+			block.newlines |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, newlines)))) << i;
+		}
+
+		return block;
+#else
+		csv_block block = { 0, 0, 0 };
+
+		for (unsigned i = 0; i < 64; ++i)
+		{
+			block.quotes |= static_cast<std::uint64_t>(pos[i] == quote) << i;
+			block.delims |= static_cast<std::uint64_t>(pos[i] == delim) << i;
+			block.newlines |= static_cast<std::uint64_t>(pos[i] == '\n') << i;
+		}
+
+		return block;
+#endif
+	}
+
+	// returns the prefix xor of a given mask (bit i being the xor of bits 0 to i), which turns the mask of the quotes of a block into the mask of its quoted characters (where opening quotes count as quoted, and closing quotes do not). Computed with a single carry-less multiplication where available.
+	static std::uint64_t prefix_xor(std::uint64_t bits) noexcept
+	{
+#if defined(__PCLMUL__) && defined(__x86_64__)
+		return static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<long long>(bits)), _mm_set1_epi8(static_cast<char>(0xFF)), 0)));
+#else
+		bits ^= bits << 1;
+		bits ^= bits << 2;
+		bits ^= bits << 4;
+		bits ^= bits << 8;
+		bits ^= bits << 16;
+		bits ^= bits << 32;
+
+		return bits;
+#endif
+	}
+
+	/*
+	appends the offsets (from a given base) of the delimiters and line feeds that are not quoted among the characters in the range [pos, end) of CSV text to a given vector of separators, given whether the character preceding the range is quoted (as a mask of all ones if so, and of zeroes otherwise), which is updated for the last character of the range.
+
+	the characters are scanned in blocks of 64, as in simdcsv: the quotes, delimiters and line feeds of a block are found at once as bit masks, the mask of its quoted characters is the prefix xor of the mask of its quotes (flipped if the block starts inside quotes), and the separators are the delimiters and line feeds that are not quoted. The last block may be partial.
+	*/
+	static void csv_separators(const char* pos, const char* const end, const char* const base, const char delim, const char quote, std::uint64_t& quoted, std::vector<size_t>& separators)
+	{
+		for (; pos < end; pos += 64)
+		{
+			const size_t n = std::min<size_t>(static_cast<size_t>(end - pos), 64);
+			csv_block block = { 0, 0, 0 };
+
+			if (n == 64)
+				block = csv_masks(pos, delim, quote);
+			else
+			{
+				char tail[64] = { };
+				std::memcpy(tail, pos, n);
+
+				const std::uint64_t in_tail = (std::uint64_t(1) << n) - 1;
+
+				block = csv_masks(tail, delim, quote);
+				block.quotes &= in_tail;
+				block.delims &= in_tail;
+				block.newlines &= in_tail;
+			}
+
+			const std::uint64_t quoted_ = prefix_xor(block.quotes) ^ quoted;
+			quoted = std::uint64_t(0) - (quoted_ >> 63);
+
+			std::uint64_t found = (block.delims | block.newlines) & ~quoted_;
+			size_t i = separators.size();
+
+			separators.resize(i + population_count(found));
+
+			for (const size_t offset = static_cast<size_t>(pos - base); found != 0; found &= found - 1)
+				separators[i++] = offset + trailing_zeros(found);
+		}
+	}
+
+	// returns the content of a given raw CSV field: the field itself, or if it is quoted, the characters between its enclosing quotes, in which case a given flag is set to whether the content has escaped (doubled) quotes.
+	static std::string_view csv_content(std::string_view raw, const char quote, bool& escaped) noexcept
+	{
+		escaped = false;
+
+		if (raw.empty() || raw.front() != quote)
+			return raw;
+
+		raw.remove_prefix(1);
+
+		if (!raw.empty() && raw.back() == quote)
+			raw.remove_suffix(1);
+
+		escaped = !raw.empty() && std::memchr(raw.data(), quote, raw.length()) != nullptr;
+
+		return raw;
+	}
+	// writes the content of a quoted CSV field with each escaped (doubled) quote replaced by a single quote to a given destination, and returns the number of characters written.
+	static size_t csv_unescape(const std::string_view content, const char quote, char* const dest) noexcept
+	{
+		size_t n = 0;
+
+		for (size_t i = 0; i < content.length(); ++i)
+		{
+			dest[n++] = content[i];
+
+			if (content[i] == quote && i + 1 < content.length() && content[i + 1] == quote)
+				++i;
+		}
+
+		return n;
+	}
+
+	// appends the fields of a record of CSV text to given fields, given the bounds of its raw fields (as offsets from the beginning of the record). Fields with escaped quotes are unescaped to a destination returned by a given function (called at most once per record), which must have room for the characters of the record. A carriage return ending the record is not part of its last field, and an empty record has no fields.
+	template<class Alloc> static void csv_fields(const char* const record, std::vector<std::pair<size_t, size_t>>& bounds, const char quote, std::vector<std::string_view>& fields, Alloc&& allocate)
+	{
+		std::pair<size_t, size_t>& last = bounds.back();
+
+		if (last.second != last.first && record[last.second - 1] == '\r')
+			--last.second;
+
+		if (bounds.size() == 1 && last.first == last.second)
+			return;
+
+		char* dest = nullptr;
+
+		for (const auto& [begin, end] : bounds)
+		{
+			bool escaped = false;
+			const std::string_view content = csv_content({ record + begin, end - begin }, quote, escaped);
+
+			if (!escaped)
+			{
+				fields.push_back(content);
+
+				continue;
+			}
+
+			if (dest == nullptr)
+				dest = allocate();
+
+			const size_t n = csv_unescape(content, quote, dest);
+
+			fields.emplace_back(dest, n);
+			dest += n;
+		}
+	}
+
+public:
+	/*
+	A reader of the records of a CSV (or TSV) file, as described by RFC 4180, meant for high-throughput ingestion.
+
+	the file is mapped into memory where possible, and otherwise read in large blocks (of 1 MiB by default), as by a line reader. The characters are tokenized 64 at a time, finding the quotes, delimiters and line feeds of each block at once as bit masks (with vector instructions where available), so quoted fields may contain delimiters and line feeds.
+
+	each field is returned as a view of the mapping or the block buffer, without its enclosing quotes, so no character is copied, except for the fields with escaped (doubled) quotes, which are unescaped into a buffer of the reader. A carriage return ending a record (as in CRLF line endings) is not part of its last field, and an empty line is a record with no fields.
+	*/
+	class csv_reader
+	{
+		native_file file = {};
+		file_mapping mapping = {};
+
+		// the buffer used when the file is not mapped, and its block size.
+		std::vector<char> buffer = {};
+		size_t block_size = 0;
+
+		char delim = ',', quote = '"';
+
+		// the characters (in the mapping or in the buffer), their offset in the file, the offsets of the record being read and of the first character not yet tokenized, and whether the character before it is quoted (as a mask).
+		const char* chars = nullptr;
+		size_t size = 0, chars_offset = 0, record_begin = 0, scanned = 0;
+		std::uint64_t quoted = 0;
+		bool at_eof = false;
+
+		// the offsets of the separators tokenized, and the index of the first of them not yet consumed.
+		std::vector<size_t> separators = {};
+		size_t next_separator = 0;
+
+		// the bounds of the raw fields of the record being read, and the buffer of its unescaped fields.
+		std::vector<std::pair<size_t, size_t>> bounds = {};
+		std::vector<char> unescaped = {};
+
+		size_t record_number_ = 0, offset_ = 0;
+
+		// The number of characters tokenized at a time, so that the separators found fit in the L1 cache.
+		static constexpr size_t tokenize_size = 1 << 14;
+
+		// moves the characters of the record being read to the front of the buffer, reads the next block of the file after them, and returns whether any character was read.
+		bool read_block()
+		{
+			const size_t remaining = size - record_begin;
+
+			if (remaining != 0 && record_begin != 0)
+				std::memmove(buffer.data(), chars + record_begin, remaining);
+
+			if (buffer.size() < remaining + block_size)
+				buffer.resize(remaining + block_size);
+
+			const size_t n_read = file.read(buffer.data() + remaining, block_size);
+
+			chars = buffer.data();
+			size = remaining + n_read;
+			chars_offset += record_begin;
+			scanned -= record_begin;
+			record_begin = 0;
+			at_eof = (n_read == 0);
+
+			return n_read != 0;
+		}
+
+		// tokenizes the next characters (replacing the separators tokenized before, which must all be consumed), reading the next blocks of the file if needed, and returns whether there were characters to tokenize. Only whole blocks of 64 characters are tokenized before the end of the file is reached.
+		bool tokenize()
+		{
+			separators.clear();
+			next_separator = 0;
+
+			while (!at_eof && size - scanned < 64)
+				read_block();
+
+			const size_t n = std::min(at_eof ? size - scanned : (size - scanned) & ~size_t(63), tokenize_size);
+
+			if (n == 0)
+				return false;
+
+			csv_separators(chars + scanned, chars + scanned + n, chars, delim, quote, quoted, separators);
+			scanned += n;
+
+			return true;
+		}
+
+	public:
+		// opens a given CSV file for reading its records, with given delimiter (a comma by default, or for example a tab for TSV files) and quote characters, mapping it into memory if possible, and otherwise reading it in blocks of a given size (1 MiB by default). Whether the file was opened can be checked with (is_open).
+		explicit csv_reader(const std::string& path, const char delim_ = ',', const char quote_ = '"', const size_t block_size_ = 1 << 20) : block_size(std::max<size_t>(block_size_, 1)), delim(delim_), quote(quote_)
+		{
+			size_t size_ = 0;
+
+			if (file.open_read(path) && file.size(size_) && mapping.map(file, size_))
+			{
+				chars = mapping.view().data();
+				size = size_;
+			}
+
+			at_eof = is_mapped() || !is_open();
+		}
+
+		// returns whether the file was opened.
+		bool is_open() const noexcept
+		{
+			return file.is_open();
+		}
+		// returns whether the file is mapped into memory (rather than being read in blocks).
+		bool is_mapped() const noexcept
+		{
+			return mapping.is_mapped();
+		}
+
+		// reads the fields of the next record into a given vector (replacing its elements), and returns whether there was a record to read. The fields are valid until the next record is read (and as long as this reader exists, if the file is mapped and the fields have no escaped quotes).
+		bool next(std::vector<std::string_view>& fields)
+		{
+			fields.clear();
+			bounds.clear();
+
+			size_t field_begin = 0, record_size = 0;
+
+			for (;;)
+			{
+				if (next_separator == separators.size())
+				{
+					if (tokenize())
+						continue;
+
+					if (record_begin == size)
+						return false;
+
+					record_size = size - record_begin;
+					bounds.emplace_back(field_begin, record_size);
+
+					break;
+				}
+
+				const size_t separator = separators[next_separator++] - record_begin;
+
+				bounds.emplace_back(field_begin, separator);
+				field_begin = separator + 1;
+
+				if (chars[record_begin + separator] == '\n')
+				{
+					record_size = separator + 1;
+
+					break;
+				}
+			}
+
+			csv_fields(chars + record_begin, bounds, quote, fields, [&]()
+			{
+				if (unescaped.size() < record_size)
+					unescaped.resize(record_size);
+
+				return unescaped.data();
+			});
+
+			offset_ = chars_offset + record_begin;
+			record_begin += record_size;
+			++record_number_;
+
+			return true;
+		}
+
+		// returns the number of the last record read (starting from 1), or zero if no record was read.
+		size_t record_number() const noexcept
+		{
+			return record_number_;
+		}
+		// returns the offset (in bytes, from the beginning of the file) of the last record read.
+		size_t offset() const noexcept
+		{
+			return offset_;
+		}
+	};
+
+	// The records of a CSV (or TSV) text parsed at once (see (parse_csv) and (read_csv)). Each field is a view of the text without its enclosing quotes, except for the fields with escaped (doubled) quotes, which are unescaped into the arena of the table.
+	class csv_table
+	{
+		// the content of a file read by (read_csv), either mapped or read into a buffer.
+		file_mapping mapping = {};
+		std::vector<char> chars = {};
+
+		std::vector<std::unique_ptr<char[]>> arena = {};
+		std::vector<std::string_view> fields = {};
+		std::vector<size_t> record_ends = {};
+
+		friend class str;
+
+	public:
+		// A record of a CSV table, as a range of its fields.
+		class record
+		{
+			const std::string_view* first = nullptr;
+			size_t n = 0;
+
+			friend class csv_table;
+
+		public:
+			// returns the number of fields of this record.
+			size_t size() const noexcept
+			{
+				return n;
+			}
+			// returns whether this record has no fields.
+			bool empty() const noexcept
+			{
+				return n == 0;
+			}
+
+			// returns the field at a given index.
+			std::string_view operator[](const size_t i) const noexcept
+			{
+				return first[i];
+			}
+
+			// returns a pointer to the first field of this record.
+			const std::string_view* begin() const noexcept
+			{
+				return first;
+			}
+			// returns a pointer to the after-the-last field of this record.
+			const std::string_view* end() const noexcept
+			{
+				return first + n;
+			}
+		};
+
+		// returns the number of records.
+		size_t size() const noexcept
+		{
+			return record_ends.size();
+		}
+		// returns whether there are no records.
+		bool empty() const noexcept
+		{
+			return record_ends.empty();
+		}
+		// returns the number of fields of every record.
+		size_t n_fields() const noexcept
+		{
+			return fields.size();
+		}
+
+		// returns the record at a given index, whose fields are valid as long as this table exists (and, for tables parsed from a string, as long as the string exists and is not modified).
+		record operator[](const size_t i) const noexcept
+		{
+			record record_ = {};
+			const size_t begin = (i == 0) ? 0 : record_ends[i - 1];
+
+			record_.first = fields.data() + begin;
+			record_.n = record_ends[i] - begin;
+
+			return record_;
+		}
+	};
+
+private:
+	/*
+	parses the records of a given CSV text into a given table, in parallel on the shared thread pool with a given number of threads (by default, every worker of the pool and the calling thread).
+
+	the text is split into chunks, and since whether a chunk starts inside quotes depends on the quotes before it, parsing takes three passes: the quotes of each chunk are counted, and the parity of the quotes before each chunk tells whether it starts inside quotes; the chunks are tokenized; and the fields of the records are built, each chunk building the records that start after its line feeds (and the first chunk the first record as well), reading the separators of the following chunks for a record that crosses the end of the chunk.
+	*/
+	static void parse_csv(const std::string_view text, const char delim, const char quote, const size_t n_threads, csv_table& table)
+	{
+		struct part
+		{
+			std::vector<std::unique_ptr<char[]>> arena;
+			std::vector<std::string_view> fields;
+			std::vector<size_t> record_ends;
+		};
+
+		const size_t n_chunks = (text.length() + scan_chunk_size - 1) / scan_chunk_size;
+
+		std::vector<std::uint64_t> quoted(n_chunks, 0);
+		std::vector<std::vector<size_t>> separators(n_chunks);
+		std::vector<part> parts(n_chunks);
+
+		if (n_chunks > 1)
+		{
+			std::vector<size_t> n_quotes(n_chunks, 0);
+
+			parallel_for(n_chunks, [&](const size_t c)
+			{
+				n_quotes[c] = static_cast<size_t>(std::count(text.begin() + c * scan_chunk_size, text.begin() + std::min((c + 1) * scan_chunk_size, text.length()), quote));
+			}, n_threads);
+
+			for (size_t c = 1; c < n_chunks; ++c)
+				quoted[c] = quoted[c - 1] ^ (std::uint64_t(0) - (n_quotes[c - 1] & 1));
+		}
+
+		parallel_for(n_chunks, [&](const size_t c)
+		{
+			csv_separators(text.data() + c * scan_chunk_size, text.data() + std::min((c + 1) * scan_chunk_size, text.length()), text.data(), delim, quote, quoted[c], separators[c]);
+		}, n_threads);
+
+		parallel_for(n_chunks, [&](const size_t c)
+		{
+			part& part_ = parts[c];
+			const size_t chunk_end = std::min((c + 1) * scan_chunk_size, text.length());
+
+			std::vector<std::pair<size_t, size_t>> bounds = {};
+			char* arena_pos = nullptr;
+			size_t arena_room = 0;
+
+			// the separators are read in order, from the separators of this chunk on.
+			size_t chunk = c, i = 0;
+
+			const auto next_separator = [&]()
+			{
+				while (chunk < n_chunks && i == separators[chunk].size())
+				{
+					++chunk;
+					i = 0;
+				}
+
+				return (chunk < n_chunks) ? separators[chunk][i++] : text.length();
+			};
+
+			size_t record_begin = 0;
+
+			if (c != 0)
+			{
+				while (i != separators[c].size() && text[separators[c][i]] != '\n')
+					++i;
+
+				if (i == separators[c].size())
+					return;
+
+				record_begin = separators[c][i++] + 1;
+			}
+
+			while (record_begin < text.length() && record_begin <= chunk_end)
+			{
+				size_t field_begin = record_begin, separator = 0;
+
+				bounds.clear();
+
+				do
+				{
+					separator = next_separator();
+					bounds.emplace_back(field_begin - record_begin, separator - record_begin);
+					field_begin = separator + 1;
+				}
+				while (separator != text.length() && text[separator] != '\n');
+
+				const size_t record_size = std::min(field_begin, text.length()) - record_begin;
+
+				csv_fields(text.data() + record_begin, bounds, quote, part_.fields, [&]()
+				{
+					if (arena_room < record_size)
+					{
+						arena_room = std::max<size_t>(record_size, 1 << 16);
+						part_.arena.emplace_back(new char[arena_room]);
+						arena_pos = part_.arena.back().get();
+					}
+
+					char* const dest = arena_pos;
+
+					arena_pos += record_size;
+					arena_room -= record_size;
+
+					return dest;
+				});
+
+				part_.record_ends.push_back(part_.fields.size());
+				record_begin = field_begin;
+			}
+		}, n_threads);
+
+		size_t n_fields = 0, n_records = 0;
+
+		for (const part& part_ : parts)
+		{
+			n_fields += part_.fields.size();
+			n_records += part_.record_ends.size();
+		}
+
+		table.fields.resize(n_fields);
+		table.record_ends.resize(n_records);
+		n_fields = n_records = 0;
+
+		for (part& part_ : parts)
+		{
+			std::copy(part_.fields.begin(), part_.fields.end(), table.fields.begin() + static_cast<std::ptrdiff_t>(n_fields));
+
+			for (const size_t record_end : part_.record_ends)
+				table.record_ends[n_records++] = n_fields + record_end;
+
+			n_fields += part_.fields.size();
+			std::move(part_.arena.begin(), part_.arena.end(), std::back_inserter(table.arena));
+		}
+	}
+
+public:
+	// parses the records of a given CSV (or TSV) text, with given delimiter (a comma by default, or for example a tab for TSV) and quote characters, in parallel with a given number of threads (by default, every worker of the shared thread pool and the calling thread). The fields are views of the text, which must outlive the table. See (csv_reader) for details on the format.
+	static csv_table parse_csv(const std::string_view text, const char delim = ',', const char quote = '"', const size_t n_threads = 0)
+	{
+		csv_table table = {};
+
+		parse_csv(text, delim, quote, n_threads, table);
+
+		return table;
+	}
+	// parses the records of this extended string as CSV (or TSV) text, with given delimiter and quote characters, in parallel with a given number of threads. The fields are views of this extended string, which must outlive the table and not be modified.
+	csv_table parse_csv(const char delim = ',', const char quote = '"', const size_t n_threads = 0) const
+	{
+		return parse_csv(std::string_view(_str), delim, quote, n_threads);
+	}
+
+	// reads and parses the records of a given CSV (or TSV) file, with given delimiter and quote characters, in parallel with a given number of threads. The file is mapped into memory where possible (and otherwise read whole into the table), and the fields are views of it. The table is empty if the file cannot be read.
+	static csv_table read_csv(const std::string& path, const char delim = ',', const char quote = '"', const size_t n_threads = 0)
+	{
+		csv_table table = {};
+		native_file file = {};
+		size_t size = 0;
+
+		if (!file.open_read(path))
+			return table;
+
+		if (file.size(size) && table.mapping.map(file, size))
+		{
+			parse_csv(table.mapping.view(), delim, quote, n_threads, table);
+
+			return table;
+		}
+
+		for (size_t n_read = 0, n = 0;; n_read += n)
+		{
+			table.chars.resize(std::max<size_t>(n_read + (1 << 20), size));
+			n = file.read(table.chars.data() + n_read, table.chars.size() - n_read);
+
+			if (n == 0)
+			{
+				table.chars.resize(n_read);
+
+				break;
+			}
+		}
+
+		parse_csv(std::string_view(table.chars.data(), table.chars.size()), delim, quote, n_threads, table);
+
+		return table;
+	}
+
+private:
+	// returns the value of a given hexadecimal digit, or -1 if the character is not a hexadecimal digit.
+	static constexpr int hex_value(const char c) noexcept
+	{
+		return (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+	}
+	// calls a given function with each character of given percent-encoded characters, decoded: each %XX sequence is decoded to the byte it encodes, and (if requested) each plus sign to a space, and malformed sequences are left as is. Stops early if the function returns false, and returns whether it did not.
+	template<class Func> static bool for_each_decoded(const std::string_view chars, const bool plus_as_space, Func&& on_char)
+	{
+		for (size_t i = 0; i < chars.length(); ++i)
+		{
+			char c = chars[i];
+
+			if (c == '%' && i + 2 < chars.length() && hex_value(chars[i + 1]) >= 0 && hex_value(chars[i + 2]) >= 0)
+			{
+				c = static_cast<char>(hex_value(chars[i + 1]) * 16 + hex_value(chars[i + 2]));
+				i += 2;
+			}
+			else if (c == '+' && plus_as_space)
+				c = ' ';
+
+			if (!on_char(c))
+				return false;
+		}
+
+		return true;
+	}
+	// returns whether given characters contain a percent-encoded sequence or (if plus signs are decoded as spaces) a plus sign.
+	static bool is_percent_encoded(const std::string_view chars, const bool plus_as_space) noexcept
+	{
+		return chars.find('%') != std::string_view::npos || (plus_as_space && chars.find('+') != std::string_view::npos);
+	}
+
+public:
+	// A key-value pair parsed by (parse_kv), as views of the parsed text.
+	struct kv_pair
+	{
+		std::string_view key = {}, value = {};
+
+		// whether the key and the value are percent-encoded (as in URL query strings, where plus signs encode spaces as well).
+		bool encoded = false;
+
+		// returns a copy of the key, percent-decoded if it is percent-encoded.
+		std::string decoded_key() const
+		{
+			return decoded(key);
+		}
+		// returns a copy of the value, percent-decoded if it is percent-encoded.
+		std::string decoded_value() const
+		{
+			return decoded(value);
+		}
+
+	private:
+		std::string decoded(const std::string_view chars) const
+		{
+			return encoded ? form_decode(chars) : std::string(chars);
+		}
+	};
+
+	/*
+	A lazy range of the key-value pairs of a text such as a URL query string ("k1=v1&k2=v2") or header lines ("key: value"), returned by (parse_kv).
+
+	the pairs are parsed one at a time while iterating, as views of the text, so nothing is allocated. Pairs are delimited by a pair delimiter, and the key of a pair is delimited from its value by the first key-value delimiter in it (a pair without one is a key with an empty value). Empty pairs are skipped. The whitespaces around keys and values are trimmed if requested (so CRLF line endings are handled as well), and keys and values are percent-decoded on request only (see (kv_pair)), except when looking up a key, which compares the decoded key without allocating.
+	*/
+	class kv_range
+	{
+		// the text and the way it is parsed, which the iterators keep a copy of (so they do not refer to the range).
+		struct syntax
+		{
+			std::string_view text = {};
+			char pair_delim = '&', kv_delim = '=';
+			bool trim = false, decode = false;
+		};
+
+		syntax syntax_ = {};
+
+		friend class str;
+
+	public:
+		// A forward iterator over the key-value pairs of a range.
+		class iterator
+		{
+			syntax syntax_ = {};
+			size_t next_pos = std::string::npos;
+			kv_pair pair = {};
+
+			friend class kv_range;
+
+			// parses the next non-empty pair, if any (otherwise becoming the end iterator).
+			void advance() noexcept
+			{
+				const std::string_view text_ = syntax_.text;
+
+				while (next_pos <= text_.length())
+				{
+					const char* const pair_end = (next_pos == text_.length()) ? nullptr : static_cast<const char*>(std::memchr(text_.data() + next_pos, syntax_.pair_delim, text_.length() - next_pos));
+					const size_t end_pos = (pair_end == nullptr) ? text_.length() : static_cast<size_t>(pair_end - text_.data());
+
+					std::string_view pair_ = text_.substr(next_pos, end_pos - next_pos);
+					next_pos = end_pos + 1;
+
+					if (syntax_.trim)
+						pair_ = trim_view(pair_);
+
+					if (pair_.empty())
+						continue;
+
+					const size_t kv_pos = pair_.find(syntax_.kv_delim);
+
+					pair.key = pair_.substr(0, kv_pos);
+					pair.value = (kv_pos == std::string_view::npos) ? std::string_view() : pair_.substr(kv_pos + 1);
+					pair.encoded = syntax_.decode;
+
+					if (syntax_.trim)
+					{
+						pair.key = trim_view(pair.key);
+						pair.value = trim_view(pair.value);
+					}
+
+					return;
+				}
+
+				next_pos = std::string::npos;
+			}
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = kv_pair;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const kv_pair*;
+			using reference = const kv_pair&;
+
+			iterator() = default;
+
+			// returns the current pair.
+			const kv_pair& operator*() const noexcept
+			{
+				return pair;
+			}
+			const kv_pair* operator->() const noexcept
+			{
+				return &pair;
+			}
+
+			// advances to the next pair.
+			iterator& operator++() noexcept
+			{
+				advance();
+
+				return *this;
+			}
+			iterator operator++(int) noexcept
+			{
+				iterator it = *this;
+				advance();
+
+				return it;
+			}
+
+			// returns whether this iterator and another are at the same pair.
+			bool operator==(const iterator& other) const noexcept
+			{
+				return next_pos == other.next_pos;
+			}
+			bool operator!=(const iterator& other) const noexcept
+			{
+				return next_pos != other.next_pos;
+			}
+		};
+
+		// returns an iterator to the first pair.
+		iterator begin() const noexcept
+		{
+			iterator it = {};
+			it.syntax_ = syntax_;
+			it.next_pos = 0;
+			it.advance();
+
+			return it;
+		}
+		// returns the end iterator.
+		iterator end() const noexcept
+		{
+			return {};
+		}
+
+		// returns an iterator to the first pair with a given (decoded) key, or the end iterator if there is none, parsing only the pairs before it.
+		iterator find(const std::string_view key) const noexcept
+		{
+			iterator it = begin();
+
+			for (; it != end(); ++it)
+			{
+				const std::string_view key_ = it->key;
+
+				if (!syntax_.decode || !is_percent_encoded(key_, true))
+				{
+					if (key_ == key)
+						break;
+
+					continue;
+				}
+
+				size_t i = 0;
+
+				if (for_each_decoded(key_, true, [&](const char c) { return i < key.length() && key[i++] == c; }) && i == key.length())
+					break;
+			}
+
+			return it;
+		}
+		// returns whether there is a pair with a given (decoded) key.
+		bool contains(const std::string_view key) const noexcept
+		{
+			return find(key) != end();
+		}
+		// returns a view of the (undecoded) value of the first pair with a given (decoded) key, or a given default value if there is none.
+		std::string_view value(const std::string_view key, const std::string_view default_value = {}) const noexcept
+		{
+			const iterator it = find(key);
+
+			return (it == end()) ? default_value : it->value;
+		}
+	};
+
+	// returns a lazy range of the key-value pairs of a given text, delimited by given pair (an ampersand by default) and key-value (an equals sign by default) delimiters, with the whitespaces around keys and values trimmed and keys and values percent-decoded if requested. The range is a view of the text, which must outlive it. See (kv_range) for details.
+	static kv_range parse_kv(const std::string_view text, const char pair_delim = '&', const char kv_delim = '=', const bool trim_ = false, const bool percent_decode = false) noexcept
+	{
+		kv_range range = {};
+		range.syntax_ = { text, pair_delim, kv_delim, trim_, percent_decode };
+
+		return range;
+	}
+	// returns a lazy range of the key-value pairs of this extended string, delimited by given pair and key-value delimiters, with the whitespaces around keys and values trimmed and keys and values percent-decoded if requested. The range is a view of this extended string, which must outlive it and not be modified.
+	kv_range parse_kv(const char pair_delim = '&', const char kv_delim = '=', const bool trim_ = false, const bool percent_decode = false) const noexcept
+	{
+		return parse_kv(std::string_view(_str), pair_delim, kv_delim, trim_, percent_decode);
+	}
+
+private:
+	// The digits of hexadecimal numbers, as written by the escaping and encoding functions.
+	static constexpr char hex_digits[17] = "0123456789ABCDEF";
+
+	// The characters that must be escaped in JSON strings: quotation marks, backslashes and control characters.
+	struct json_specials
+	{
+		// returns whether a given character must be escaped.
+		static constexpr bool contains(const char c) noexcept
+		{
+			return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+		}
+		static constexpr bool is_single() noexcept
+		{
+			return false;
+		}
+		static constexpr bool is_vectorized() noexcept
+		{
+			return true;
+		}
+		static constexpr char first() noexcept
+		{
+			return '"';
+		}
+
+#if defined(STR_AVX2)
+		// returns a mask of the characters of a given block which must be escaped.
+		static __m256i match(const __m256i block) noexcept
+		{
+			const __m256i controls = _mm256_cmpeq_epi8(_mm256_min_epu8(block, _mm256_set1_epi8(0x1F)), block);
+
+			return _mm256_or_si256(controls, _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\'))));
+		}
+#endif
+#if defined(STR_SSE2)
+		// returns a mask of the characters of a given block which must be escaped.
+		static __m128i match(const __m128i block) noexcept
+		{
+			const __m128i controls = _mm_cmpeq_epi8(_mm_min_epu8(block, _mm_set1_epi8(0x1F)), block);
+
+			return _mm_or_si128(controls, _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'))));
+		}
+#endif
+	};
+
+	// The characters that must be percent-encoded in URLs: every character except the unreserved ones (ASCII letters and digits, and "-._~").
+	struct url_specials
+	{
+		// returns whether a given character must be percent-encoded.
+		static constexpr bool contains(const char c) noexcept
+		{
+			return !((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~');
+		}
+		static constexpr bool is_single() noexcept
+		{
+			return false;
+		}
+		static constexpr bool is_vectorized() noexcept
+		{
+			return true;
+		}
+		static constexpr char first() noexcept
+		{
+			return ' ';
+		}
+
+#if defined(STR_AVX2)
+		// returns a mask of the characters of a given block which must be percent-encoded. (a character is in the range [first, last] if its distance from (first) is at most the length of the range, as unsigned bytes.)
+		static __m256i match(const __m256i block) noexcept
+		{
+			const auto in_range = [&](const char first, const char last)
+			{
+				const __m256i distance = _mm256_sub_epi8(block, _mm256_set1_epi8(first));
+
+				return _mm256_cmpeq_epi8(_mm256_min_epu8(distance, _mm256_set1_epi8(static_cast<char>(last - first))), distance);
+			};
+			const auto equal = [&](const char c)
+			{
+				return _mm256_cmpeq_epi8(block, _mm256_set1_epi8(c));
+			};
+
+			const __m256i unreserved = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(in_range('a', 'z'), in_range('A', 'Z')), _mm256_or_si256(in_range('0', '9'), equal('-'))),
+				_mm256_or_si256(_mm256_or_si256(equal('_'), equal('.')), equal('~')));
+
+			return _mm256_xor_si256(unreserved, _mm256_set1_epi8(-1));
+		}
+#endif
+#if defined(STR_SSE2)
+		// returns a mask of the characters of a given block which must be percent-encoded.
+		static __m128i match(const __m128i block) noexcept
+		{
+			const auto in_range = [&](const char first, const char last)
+			{
+				const __m128i distance = _mm_sub_epi8(block, _mm_set1_epi8(first));
+
+				return _mm_cmpeq_epi8(_mm_min_epu8(distance, _mm_set1_epi8(static_cast<char>(last - first))), distance);
+			};
+			const auto equal = [&](const char c)
+			{
+				return _mm_cmpeq_epi8(block, _mm_set1_epi8(c));
+			};
+
+			const __m128i unreserved = _mm_or_si128(_mm_or_si128(_mm_or_si128(in_range('a', 'z'), in_range('A', 'Z')), _mm_or_si128(in_range('0', '9'), equal('-'))),
+				_mm_or_si128(_mm_or_si128(equal('_'), equal('.')), equal('~')));
+
+			return _mm_xor_si128(unreserved, _mm_set1_epi8(-1));
+		}
+#endif
+	};
+
+	// The characters that must be escaped in HTML text and attribute values.
+	using html_specials = static_delimiter_set<'&', '<', '>', '"', '\''>;
+
+	// returns the number of characters of given characters escaped by a given function (which takes a character of a given set of characters to escape and a destination, null when only measuring, and returns the length of its escape sequence).
+	template<class Specials, class Escape> static size_t escaped_size(const std::string_view chars, const Specials& specials, Escape&& escape) noexcept
+	{
+		const char* const end = chars.data() + chars.length();
+		size_t size = chars.length();
+
+		for (const char* pos = find_delim<true>(chars.data(), end, specials); pos != end; pos = find_delim<true>(pos + 1, end, specials))
+			size += escape(*pos, nullptr) - 1;
+
+		return size;
+	}
+	// writes given characters escaped by a given function to a given destination, which must have room for them. The runs of characters that need no escaping are found with vector compares and copied at once.
+	template<class Specials, class Escape> static void write_escaped(const std::string_view chars, char* dest, const Specials& specials, Escape&& escape) noexcept
+	{
+		const char* const end = chars.data() + chars.length();
+
+		for (const char* pos = chars.data(); pos != end;)
+		{
+			const char* const special = find_delim<true>(pos, end, specials);
+
+			std::memcpy(dest, pos, static_cast<size_t>(special - pos));
+			dest += special - pos;
+
+			if (special == end)
+				break;
+
+			dest += escape(*special, dest);
+			pos = special + 1;
+		}
+	}
+	// returns an STL string of given characters escaped by a given function, measuring them first so that the string is allocated once.
+	template<class Specials, class Escape> static std::string escaped(const std::string_view chars, const Specials& specials, Escape&& escape)
+	{
+		// (an escape sequence may be a single character, as a space is in a form, so characters measured at their own length may still have to be escaped.)
+		std::string escaped_(escaped_size(chars, specials, escape), '\0');
+		write_escaped(chars, escaped_.data(), specials, escape);
+
+		return escaped_;
+	}
+	// writes given characters escaped by a given function to a given destination if it has room for them (a null destination having none), and returns the number of escaped characters.
+	template<class Specials, class Escape> static size_t escape_to(const std::string_view chars, char* const dest, const size_t dest_size, const Specials& specials, Escape&& escape) noexcept
+	{
+		const size_t size = escaped_size(chars, specials, escape);
+
+		if (dest != nullptr && size <= dest_size)
+			write_escaped(chars, dest, specials, escape);
+
+		return size;
+	}
+
+	// writes given characters unescaped to a given destination (which must have room for them, as unescaping never lengthens characters), or only measures them if the destination is null, and returns the number of unescaped characters. Each escape sequence starts with a character of a given set, and is unescaped by a given function (which takes the position of the sequence, which it advances past it, the end of the characters and a destination, null when only measuring, and returns the number of unescaped characters). The runs of characters between the sequences are found with vector compares and copied at once.
+	template<class Specials, class Unescape> static size_t write_unescaped(const std::string_view chars, char* const dest, const Specials& specials, Unescape&& unescape) noexcept
+	{
+		const char* const end = chars.data() + chars.length();
+		size_t size = 0;
+
+		for (const char* pos = chars.data(); pos != end;)
+		{
+			const char* special = find_delim<true>(pos, end, specials);
+
+			if (dest != nullptr)
+				std::memcpy(dest + size, pos, static_cast<size_t>(special - pos));
+
+			size += static_cast<size_t>(special - pos);
+
+			if (special == end)
+				break;
+
+			size += unescape(special, end, (dest != nullptr) ? dest + size : nullptr);
+			pos = special;
+		}
+
+		return size;
+	}
+	// returns an STL string of given characters unescaped by a given function.
+	template<class Specials, class Unescape> static std::string unescaped(const std::string_view chars, const Specials& specials, Unescape&& unescape)
+	{
+		std::string unescaped_(chars.length(), '\0');
+		unescaped_.resize(write_unescaped(chars, unescaped_.data(), specials, unescape));
+
+		return unescaped_;
+	}
+	// writes given characters unescaped by a given function to a given destination if it has room for them (a null destination having none), and returns the number of unescaped characters. The characters are measured first only if the destination may be too small for them.
+	template<class Specials, class Unescape> static size_t unescape_to(const std::string_view chars, char* const dest, const size_t dest_size, const Specials& specials, Unescape&& unescape) noexcept
+	{
+		if (dest != nullptr && dest_size >= chars.length())
+			return write_unescaped(chars, dest, specials, unescape);
+
+		const size_t size = write_unescaped(chars, nullptr, specials, unescape);
+
+		if (dest != nullptr && size <= dest_size)
+			write_unescaped(chars, dest, specials, unescape);
+
+		return size;
+	}
+
+	// writes the escape sequence of a given character of a JSON string to a given destination (unless it is null), and returns its length.
+	static size_t escape_json_char(const char c, char* const dest) noexcept
+	{
+		char escape = 0;
+
+		switch (c)
+		{
+		case '"': escape = '"'; break;
+		case '\\': escape = '\\'; break;
+		case '\b': escape = 'b'; break;
+		case '\f': escape = 'f'; break;
+		case '\n': escape = 'n'; break;
+		case '\r': escape = 'r'; break;
+		case '\t': escape = 't'; break;
+		default: break;
+		}
+
+		if (escape != 0)
+		{
+			if (dest != nullptr)
+			{
+				dest[0] = '\\';
+				dest[1] = escape;
+			}
+
+			return 2;
+		}
+
+		if (dest != nullptr)
+		{
+			std::memcpy(dest, "\\u00", 4);
+			dest[4] = hex_digits[static_cast<unsigned char>(c) >> 4];
+			dest[5] = hex_digits[static_cast<unsigned char>(c) & 0xF];
+		}
+
+		return 6;
+	}
+	// writes the escape sequence (a character reference) of a given character of HTML text to a given destination (unless it is null), and returns its length.
+	static size_t escape_html_char(const char c, char* const dest) noexcept
+	{
+		const std::string_view reference = (c == '&') ? "&amp;" : (c == '<') ? "&lt;" : (c == '>') ? "&gt;" : (c == '"') ? "&quot;" : "&#39;";
+
+		if (dest != nullptr)
+			std::memcpy(dest, reference.data(), reference.length());
+
+		return reference.length();
+	}
+	// writes the percent-encoded sequence of a given character to a given destination (unless it is null), and returns its length.
+	static size_t escape_url_char(const char c, char* const dest) noexcept
+	{
+		if (dest != nullptr)
+		{
+			dest[0] = '%';
+			dest[1] = hex_digits[static_cast<unsigned char>(c) >> 4];
+			dest[2] = hex_digits[static_cast<unsigned char>(c) & 0xF];
+		}
+
+		return 3;
+	}
+	// writes the form-encoded sequence of a given character (a plus sign for a space, and the percent-encoded sequence otherwise) to a given destination (unless it is null), and returns its length.
+	static size_t escape_form_char(const char c, char* const dest) noexcept
+	{
+		if (c != ' ')
+			return escape_url_char(c, dest);
+
+		if (dest != nullptr)
+			dest[0] = '+';
+
+		return 1;
+	}
+
+	// returns the number represented by a given number of hexadecimal digits starting at a given position, or -1 if not all of them are hexadecimal digits.
+	static long hex_number(const char* const pos, const size_t n_digits) noexcept
+	{
+		long number = 0;
+
+		for (size_t i = 0; i < n_digits; ++i)
+		{
+			const int digit = hex_value(pos[i]);
+
+			if (digit < 0)
+				return -1;
+
+			number = number * 16 + digit;
+		}
+
+		return number;
+	}
+	// writes a given code point encoded in UTF-8 to a given destination (unless it is null), and returns the number of bytes of the encoding.
+	static size_t write_codepoint(const char32_t cp, char* const dest) noexcept
+	{
+		char encoded[4] = { };
+		const size_t n = utf8_encode(cp, encoded);
+
+		if (dest != nullptr)
+			std::memcpy(dest, encoded, n);
+
+		return n;
+	}
+	// unescapes the JSON escape sequence at a given position (a backslash), which is advanced past it, and returns the number of unescaped characters written to a given destination (unless it is null). Escaped UTF-16 surrogate pairs are combined, lone surrogates are unescaped to the replacement character (U+FFFD), and malformed sequences are left as is.
+	static size_t unescape_json_sequence(const char*& pos, const char* const end, char* const dest) noexcept
+	{
+		char c = (end - pos >= 2) ? pos[1] : 0;
+
+		switch (c)
+		{
+		case '"': case '\\': case '/': break;
+		case 'b': c = '\b'; break;
+		case 'f': c = '\f'; break;
+		case 'n': c = '\n'; break;
+		case 'r': c = '\r'; break;
+		case 't': c = '\t'; break;
+		case 'u':
+		{
+			const long unit = (end - pos >= 6) ? hex_number(pos + 2, 4) : -1;
+
+			if (unit < 0)
+			{
+				c = 0;
+
+				break;
+			}
+
+			char32_t cp = static_cast<char32_t>(unit);
+			pos += 6;
+
+			if (cp >= 0xD800 && cp <= 0xDBFF && end - pos >= 6 && pos[0] == '\\' && pos[1] == 'u')
+			{
+				const long low = hex_number(pos + 2, 4);
+
+				if (low >= 0xDC00 && low <= 0xDFFF)
+				{
+					cp = 0x10000 + ((cp - 0xD800) << 10) + (static_cast<char32_t>(low) - 0xDC00);
+					pos += 6;
+				}
+			}
+
+			return write_codepoint((cp >= 0xD800 && cp <= 0xDFFF) ? 0xFFFD : cp, dest);
+		}
+		default:
+			c = 0;
+			break;
+		}
+
+		if (c == 0)
+		{
+			if (dest != nullptr)
+				dest[0] = '\\';
+
+			++pos;
+
+			return 1;
+		}
+
+		if (dest != nullptr)
+			dest[0] = c;
+
+		pos += 2;
+
+		return 1;
+	}
+	// unescapes the HTML character reference at a given position (an ampersand), which is advanced past it, and returns the number of unescaped characters written to a given destination (unless it is null). The references to the characters escaped by (escape_html) and (&apos;), and numeric references, are unescaped, and other references are left as is.
+	static size_t unescape_html_reference(const char*& pos, const char* const end, char* const dest) noexcept
+	{
+		const char* const semicolon = static_cast<const char*>(std::memchr(pos, ';', std::min<size_t>(static_cast<size_t>(end - pos), 12)));
+		const std::string_view name = (semicolon == nullptr) ? std::string_view() : std::string_view(pos + 1, static_cast<size_t>(semicolon - pos - 1));
+
+		char32_t cp = 0;
+
+		if (name == "amp")
+			cp = '&';
+		else if (name == "lt")
+			cp = '<';
+		else if (name == "gt")
+			cp = '>';
+		else if (name == "quot")
+			cp = '"';
+		else if (name == "apos")
+			cp = '\'';
+		else if (name.length() >= 2 && name[0] == '#')
+		{
+			long number = 0;
+
+			if (name[1] == 'x' || name[1] == 'X')
+				number = (name.length() > 2 && name.length() <= 8) ? hex_number(name.data() + 2, name.length() - 2) : -1;
+			else
+				for (size_t i = 1; i < name.length() && number >= 0; ++i)
+					number = (name[i] >= '0' && name[i] <= '9' && number <= 0x10FFFF) ? number * 10 + (name[i] - '0') : -1;
+
+			if (number > 0 && number <= 0x10FFFF && !(number >= 0xD800 && number <= 0xDFFF))
+				cp = static_cast<char32_t>(number);
+		}
+
+		if (cp == 0)
+		{
+			if (dest != nullptr)
+				dest[0] = '&';
+
+			++pos;
+
+			return 1;
+		}
+
+		pos = semicolon + 1;
+
+		return write_codepoint(cp, dest);
+	}
+	// decodes the percent-encoded sequence at a given position (a percent sign, or if plus signs are decoded as spaces, a plus sign), which is advanced past it, and returns the number of decoded characters written to a given destination (unless it is null). Malformed sequences are left as is.
+	template<bool plus_as_space> static size_t decode_url_sequence(const char*& pos, const char* const end, char* const dest) noexcept
+	{
+		char c = *pos;
+
+		if (plus_as_space && c == '+')
+			c = ' ';
+		else if (end - pos >= 3 && hex_value(pos[1]) >= 0 && hex_value(pos[2]) >= 0)
+		{
+			c = static_cast<char>(hex_number(pos + 1, 2));
+			pos += 2;
+		}
+
+		if (dest != nullptr)
+			dest[0] = c;
+
+		++pos;
+
+		return 1;
+	}
+
+public:
+	// returns a given STL string (or string view) escaped for use in a JSON string (without the enclosing quotation marks): quotation marks, backslashes and control characters are escaped, and other characters (including UTF-8 sequences) are kept. The output is measured first, so it is allocated once, and the runs of characters that need no escaping are found with vector compares and copied at once.
+	static std::string escape_json(const std::string_view str_)
+	{
+		return escaped(str_, json_specials(), escape_json_char);
+	}
+	// returns this extended string escaped for use in a JSON string (without the enclosing quotation marks).
+	str escape_json() const
+	{
+		return escape_json(_str);
+	}
+	// writes a given character array of a given length, escaped for use in a JSON string, to a given destination if it has room for the escaped characters (a null destination having none), and returns the number of escaped characters.
+	static size_t escape_json(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return escape_to({ chars, len }, dest, dest_size, json_specials(), escape_json_char);
+	}
+
+	// returns a given STL string (or string view) with its JSON escape sequences unescaped (escaped UTF-16 surrogate pairs being combined into a single UTF-8 sequence). Malformed sequences are left as is, and lone surrogates are unescaped to the replacement character (U+FFFD).
+	static std::string unescape_json(const std::string_view str_)
+	{
+		return unescaped(str_, static_delimiter_set<'\\'>(), unescape_json_sequence);
+	}
+	// returns this extended string with its JSON escape sequences unescaped.
+	str unescape_json() const
+	{
+		return unescape_json(_str);
+	}
+	// writes a given character array of a given length, with its JSON escape sequences unescaped, to a given destination if it has room for the unescaped characters (a null destination having none), and returns the number of unescaped characters, which is at most the length of the array.
+	static size_t unescape_json(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return unescape_to({ chars, len }, dest, dest_size, static_delimiter_set<'\\'>(), unescape_json_sequence);
+	}
+
+	// returns a given STL string (or string view) escaped for use in HTML text or attribute values: ampersands, angle brackets, quotation marks and apostrophes are replaced by character references. The output is measured first, so it is allocated once, and the runs of characters that need no escaping are found with vector compares and copied at once.
+	static std::string escape_html(const std::string_view str_)
+	{
+		return escaped(str_, html_specials(), escape_html_char);
+	}
+	// returns this extended string escaped for use in HTML text or attribute values.
+	str escape_html() const
+	{
+		return escape_html(_str);
+	}
+	// writes a given character array of a given length, escaped for use in HTML, to a given destination if it has room for the escaped characters (a null destination having none), and returns the number of escaped characters.
+	static size_t escape_html(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return escape_to({ chars, len }, dest, dest_size, html_specials(), escape_html_char);
+	}
+
+	// returns a given STL string (or string view) with its HTML character references unescaped: the references to the characters escaped by (escape_html) and (&apos;), and decimal and hexadecimal numeric references (to UTF-8 sequences). Other references are left as is.
+	static std::string unescape_html(const std::string_view str_)
+	{
+		return unescaped(str_, static_delimiter_set<'&'>(), unescape_html_reference);
+	}
+	// returns this extended string with its HTML character references unescaped.
+	str unescape_html() const
+	{
+		return unescape_html(_str);
+	}
+	// writes a given character array of a given length, with its HTML character references unescaped, to a given destination if it has room for the unescaped characters (a null destination having none), and returns the number of unescaped characters, which is at most the length of the array.
+	static size_t unescape_html(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return unescape_to({ chars, len }, dest, dest_size, static_delimiter_set<'&'>(), unescape_html_reference);
+	}
+
+	// returns a given STL string (or string view) percent-encoded for use in a URL component (as described by RFC 3986): every character but ASCII letters and digits and "-._~" is encoded as %XX. The output is measured first, so it is allocated once, and the runs of characters that need no encoding are found with vector compares and copied at once.
+	static std::string url_encode(const std::string_view str_)
+	{
+		return escaped(str_, url_specials(), escape_url_char);
+	}
+	// returns this extended string percent-encoded for use in a URL component.
+	str url_encode() const
+	{
+		return url_encode(_str);
+	}
+	// writes a given character array of a given length, percent-encoded, to a given destination if it has room for the encoded characters (a null destination having none), and returns the number of encoded characters.
+	static size_t url_encode(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return escape_to({ chars, len }, dest, dest_size, url_specials(), escape_url_char);
+	}
+
+	// returns a given STL string (or string view) with its percent-encoded sequences decoded. Malformed sequences are left as is, and plus signs are kept (see (form_decode)).
+	static std::string url_decode(const std::string_view str_)
+	{
+		return unescaped(str_, static_delimiter_set<'%'>(), decode_url_sequence<false>);
+	}
+	// returns this extended string with its percent-encoded sequences decoded.
+	str url_decode() const
+	{
+		return url_decode(_str);
+	}
+	// writes a given character array of a given length, with its percent-encoded sequences decoded, to a given destination if it has room for the decoded characters (a null destination having none), and returns the number of decoded characters, which is at most the length of the array.
+	static size_t url_decode(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return unescape_to({ chars, len }, dest, dest_size, static_delimiter_set<'%'>(), decode_url_sequence<false>);
+	}
+
+	// returns a given STL string (or string view) encoded as HTML form data (application/x-www-form-urlencoded), as in URL query strings: percent-encoded as by (url_encode), except for spaces, which are encoded as plus signs.
+	static std::string form_encode(const std::string_view str_)
+	{
+		return escaped(str_, url_specials(), escape_form_char);
+	}
+	// returns this extended string encoded as HTML form data.
+	str form_encode() const
+	{
+		return form_encode(_str);
+	}
+	// writes a given character array of a given length, encoded as HTML form data, to a given destination if it has room for the encoded characters (a null destination having none), and returns the number of encoded characters.
+	static size_t form_encode(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return escape_to({ chars, len }, dest, dest_size, url_specials(), escape_form_char);
+	}
+
+	// returns a given STL string (or string view) decoded from HTML form data: with its percent-encoded sequences decoded, and its plus signs decoded as spaces.
+	static std::string form_decode(const std::string_view str_)
+	{
+		return unescaped(str_, static_delimiter_set<'%', '+'>(), decode_url_sequence<true>);
+	}
+	// returns this extended string decoded from HTML form data.
+	str form_decode() const
+	{
+		return form_decode(_str);
+	}
+	// writes a given character array of a given length, decoded from HTML form data, to a given destination if it has room for the decoded characters (a null destination having none), and returns the number of decoded characters, which is at most the length of the array.
+	static size_t form_decode(const char* const chars, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		return unescape_to({ chars, len }, dest, dest_size, static_delimiter_set<'%', '+'>(), decode_url_sequence<true>);
+	}
+
+	// The alphabets of base64, as described by RFC 4648: the standard alphabet (ending with "+/", with the encoded characters padded with "=" to a multiple of 4), and the URL- and filename-safe alphabet (ending with "-_", without padding).
+	enum base64_alphabet : std::int8_t { base64_standard = 0, base64_url = 1 };
+
+private:
+	// The digits of hexadecimal numbers written by (to_hex).
+	static constexpr char lower_hex_digits[17] = "0123456789abcdef";
+
+	// returns the characters of a given base64 alphabet, in the order of their values.
+	static constexpr const char* base64_chars(const base64_alphabet alphabet) noexcept
+	{
+		return (alphabet == base64_url) ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_" : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	}
+	// returns the values of the characters of a given base64 alphabet, indexed by character (64 for the characters that are not in the alphabet).
+	static const std::array<std::uint8_t, 256>& base64_values(const base64_alphabet alphabet) noexcept
+	{
+		constexpr auto values_of = [](const char* const chars)
+		{
+			std::array<std::uint8_t, 256> values = { };
+
+			for (size_t c = 0; c < 256; ++c)
+				values[c] = 64;
+			for (std::uint8_t value = 0; value < 64; ++value)
+				values[static_cast<unsigned char>(chars[value])] = value;
+
+			return values;
+		};
+
+		static constexpr std::array<std::uint8_t, 256> standard_values = values_of(base64_chars(base64_standard)), url_values = values_of(base64_chars(base64_url));
+
+		return (alphabet == base64_url) ? url_values : standard_values;
+	}
+
+	// returns the number of characters of given bytes encoded in base64 with a given alphabet.
+	static constexpr size_t base64_size(const size_t len, const base64_alphabet alphabet) noexcept
+	{
+		return (alphabet == base64_url) ? len / 3 * 4 + ((len % 3 == 0) ? 0 : len % 3 + 1) : (len + 2) / 3 * 4;
+	}
+
+	/*
+	writes given bytes encoded in base64 with a given alphabet to a given destination, which must have room for them.
+
+	where AVX2 instructions are available, 24 bytes are encoded at a time, as described by Muła and Lemire: the bytes are shuffled so that each 32-bit lane holds 3 of them, the four 6-bit values of each lane are moved into separate bytes with two multiplications, and each value is translated into its character by adding the offset of its range of the alphabet, which is looked up with a byte shuffle. The rest is encoded 3 bytes at a time.
+	*/
+	static void write_base64(const unsigned char* data, size_t len, char* dest, const base64_alphabet alphabet) noexcept
+	{
+		const char* const chars = base64_chars(alphabet);
+
+#if defined(STR_AVX2)
+		const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+		const char offset_62 = static_cast<char>(chars[62] - 62), offset_63 = static_cast<char>(chars[63] - 63);
+		const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, offset_62, offset_63, 'A', 0, 0,
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, offset_62, offset_63, 'A', 0, 0);
+
+		// (the second half of the bytes is loaded from 12 bytes on, so 28 bytes must be readable.)
+		for (; len >= 28; data += 24, len -= 24, dest += 32)
+		{
+			const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 12));
+			const __m256i bytes = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1), shuffle);
+
+			const __m256i values = _mm256_or_si256(_mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040)),
+				_mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010)));
+
+			// the ranges of the alphabet: 0 for lowercase letters, 1 to 10 for digits, 11 and 12 for the last two characters, and 13 for uppercase letters.
+			const __m256i ranges = _mm256_or_si256(_mm256_subs_epu8(values, _mm256_set1_epi8(51)), _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), values), _mm256_set1_epi8(13)));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, ranges)));
+		}
+#endif
+
+		for (; len >= 3; data += 3, len -= 3, dest += 4)
+		{
+			const std::uint32_t group = (std::uint32_t(data[0]) << 16) | (std::uint32_t(data[1]) << 8) | data[2];
+
+			dest[0] = chars[group >> 18];
+			dest[1] = chars[(group >> 12) & 0x3F];
+			dest[2] = chars[(group >> 6) & 0x3F];
+			dest[3] = chars[group & 0x3F];
+		}
+
+		if (len != 0)
+		{
+			const std::uint32_t group = (std::uint32_t(data[0]) << 16) | ((len == 2) ? std::uint32_t(data[1]) << 8 : 0);
+
+			*dest++ = chars[group >> 18];
+			*dest++ = chars[(group >> 12) & 0x3F];
+
+			if (len == 2)
+				*dest++ = chars[(group >> 6) & 0x3F];
+
+			if (alphabet == base64_standard)
+			{
+				if (len == 1)
+					*dest++ = '=';
+
+				*dest = '=';
+			}
+		}
+	}
+
+	// returns the number of characters of given base64 characters without their padding, or (npos) if the padding is not valid: the characters must be padded to a multiple of 4 with the standard alphabet, and may be padded with the URL-safe alphabet.
+	static size_t unpadded_base64_length(const char* const chars, const size_t len, const base64_alphabet alphabet) noexcept
+	{
+		size_t n_padding = 0;
+
+		while (n_padding < 2 && n_padding < len && chars[len - 1 - n_padding] == '=')
+			++n_padding;
+
+		if ((n_padding != 0 || alphabet == base64_standard) && len % 4 != 0)
+			return std::string::npos;
+
+		return len - n_padding;
+	}
+
+	/*
+	decodes given base64 characters (without padding) with a given alphabet, writing the bytes to a given destination (which must have room for them) unless it is null, and returns the number of bytes, or (npos) if the characters are not valid base64: if a character is not in the alphabet, if the number of characters leaves a single character over, or if the last character encodes bits of no byte that are not zero (so that every sequence of bytes has a single encoding).
+
+	where AVX2 instructions are available, 32 characters are decoded at a time, as described by Muła and Lemire (with the characters translated into their values by range compares, so that both alphabets are handled alike): each character is checked to be in a range of the alphabet and given the offset of its range, and the 6-bit values are packed into 24 bytes with two multiply-adds and two shuffles. The rest is decoded 4 characters at a time with a lookup table.
+	*/
+	static size_t read_base64(const char* chars, size_t len, unsigned char* const dest, const base64_alphabet alphabet) noexcept
+	{
+		if (len % 4 == 1)
+			return std::string::npos;
+
+		const std::array<std::uint8_t, 256>& values = base64_values(alphabet);
+		size_t size = 0;
+
+#if defined(STR_AVX2)
+		const char char_62 = base64_chars(alphabet)[62], char_63 = base64_chars(alphabet)[63];
+		const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+		// (32 bytes are stored for every 24 decoded, so the loop stops while 8 more bytes are to be decoded.)
+		for (; len >= 48; chars += 32, len -= 32, size += 24)
+		{
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars));
+
+			const auto in_range = [&](const char first, const char last)
+			{
+				const __m256i distance = _mm256_sub_epi8(block, _mm256_set1_epi8(first));
+
+				return _mm256_cmpeq_epi8(_mm256_min_epu8(distance, _mm256_set1_epi8(static_cast<char>(last - first))), distance);
+			};
+
+			const __m256i upper = in_range('A', 'Z'), lower = in_range('a', 'z'), digits = in_range('0', '9');
+			const __m256i is_62 = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(char_62)), is_63 = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(char_63));
+			const __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), digits), _mm256_or_si256(is_62, is_63));
+
+			if (_mm256_movemask_epi8(valid) != -1)
+				return std::string::npos;
+
+			const __m256i offsets = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')), _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+				_mm256_or_si256(_mm256_and_si256(digits, _mm256_set1_epi8(52 - '0')), _mm256_or_si256(_mm256_and_si256(is_62, _mm256_set1_epi8(static_cast<char>(62 - char_62))), _mm256_and_si256(is_63, _mm256_set1_epi8(static_cast<char>(63 - char_63))))));
+			const __m256i block_values = _mm256_add_epi8(block, offsets);
+
+			const __m256i pairs = _mm256_maddubs_epi16(block_values, _mm256_set1_epi32(0x01400140));
+			const __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+			const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(groups, pack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+			if (dest != nullptr)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + size), bytes);
+		}
+#endif
+
+		std::uint32_t invalid = 0;
+
+		for (; len >= 4; chars += 4, len -= 4, size += 3)
+		{
+			const std::uint32_t value_0 = values[static_cast<unsigned char>(chars[0])], value_1 = values[static_cast<unsigned char>(chars[1])];
+			const std::uint32_t value_2 = values[static_cast<unsigned char>(chars[2])], value_3 = values[static_cast<unsigned char>(chars[3])];
+			const std::uint32_t group = (value_0 << 18) | (value_1 << 12) | (value_2 << 6) | value_3;
+
+			invalid |= value_0 | value_1 | value_2 | value_3;
+
+			if (dest != nullptr)
+			{
+				dest[size] = static_cast<unsigned char>(group >> 16);
+				dest[size + 1] = static_cast<unsigned char>(group >> 8);
+				dest[size + 2] = static_cast<unsigned char>(group);
+			}
+		}
+
+		if (len != 0)
+		{
+			const std::uint32_t value_0 = values[static_cast<unsigned char>(chars[0])], value_1 = values[static_cast<unsigned char>(chars[1])];
+			const std::uint32_t value_2 = (len == 3) ? values[static_cast<unsigned char>(chars[2])] : 0;
+			const std::uint32_t group = (value_0 << 18) | (value_1 << 12) | (value_2 << 6);
+
+			invalid |= value_0 | value_1 | value_2;
+
+			// the bits of the last character that encode no byte must be zero.
+			if ((group & ((len == 2) ? 0xFFFF : 0xFF)) != 0)
+				return std::string::npos;
+
+			if (dest != nullptr)
+			{
+				dest[size] = static_cast<unsigned char>(group >> 16);
+
+				if (len == 3)
+					dest[size + 1] = static_cast<unsigned char>(group >> 8);
+			}
+
+			size += len - 1;
+		}
+
+		return ((invalid & 64) != 0) ? std::string::npos : size;
+	}
+
+	/*
+	writes given bytes encoded in hexadecimal (with lowercase digits) to a given destination, which must have room for them.
+
+	where vector instructions are available, 32 (or 16) bytes are encoded at a time: the high and low 4 bits of each byte are separated, turned into digits by adding '0' and (for the values above 9) the distance from the digit after '9' to 'a', and interleaved.
+	*/
+	static void write_hex(const unsigned char* data, size_t len, char* dest) noexcept
+	{
+#if defined(STR_AVX2)
+		for (; len >= 32; data += 32, len -= 32, dest += 64)
+		{
+			const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+
+			const auto digits = [](const __m256i values)
+			{
+				return _mm256_add_epi8(values, _mm256_add_epi8(_mm256_set1_epi8('0'), _mm256_and_si256(_mm256_cmpgt_epi8(values, _mm256_set1_epi8(9)), _mm256_set1_epi8('a' - '9' - 1))));
+			};
+
+			const __m256i high = digits(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F))), low = digits(_mm256_and_si256(bytes, _mm256_set1_epi8(0x0F)));
+			const __m256i first = _mm256_unpacklo_epi8(high, low), second = _mm256_unpackhi_epi8(high, low);
+
+			// (the unpacking interleaves the halves of each 128-bit lane, which are put back in order.)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_permute2x128_si256(first, second, 0x20));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 32), _mm256_permute2x128_si256(first, second, 0x31));
+		}
+#endif
+#if defined(STR_SSE2)
+		for (; len >= 16; data += 16, len -= 16, dest += 32)
+		{
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+			const auto digits = [](const __m128i values)
+			{
+				return _mm_add_epi8(values, _mm_add_epi8(_mm_set1_epi8('0'), _mm_and_si128(_mm_cmpgt_epi8(values, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '9' - 1))));
+			};
+
+			const __m128i high = digits(_mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F))), low = digits(_mm_and_si128(bytes, _mm_set1_epi8(0x0F)));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi8(high, low));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), _mm_unpackhi_epi8(high, low));
+		}
+#endif
+
+		for (; len != 0; ++data, --len, dest += 2)
+		{
+			dest[0] = lower_hex_digits[*data >> 4];
+			dest[1] = lower_hex_digits[*data & 0xF];
+		}
+	}
+
+	/*
+	decodes given hexadecimal characters (with lowercase or uppercase digits) to a given number of bytes (half their number), writing them to a given destination (which must have room for them) unless it is null, and returns whether every character is a hexadecimal digit.
+
+	where vector instructions are available, 32 (or 16) characters are decoded at a time: each character is checked to be a digit or (once made lowercase) a letter from 'a' to 'f' by range compares and given the value of its range, and the values of each pair are combined into a byte as a 16-bit lane, which are narrowed to bytes.
+	*/
+	static bool read_hex(const char* chars, size_t n_bytes, unsigned char* dest) noexcept
+	{
+#if defined(STR_AVX2)
+		for (; n_bytes >= 16; chars += 32, n_bytes -= 16)
+		{
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars)), lower = _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+
+			const auto in_range = [](const __m256i block_, const char first, const char last)
+			{
+				const __m256i distance = _mm256_sub_epi8(block_, _mm256_set1_epi8(first));
+
+				return _mm256_cmpeq_epi8(_mm256_min_epu8(distance, _mm256_set1_epi8(static_cast<char>(last - first))), distance);
+			};
+
+			const __m256i digits = in_range(block, '0', '9'), letters = in_range(lower, 'a', 'f');
+
+			if (_mm256_movemask_epi8(_mm256_or_si256(digits, letters)) != -1)
+				return false;
+
+			const __m256i values = _mm256_or_si256(_mm256_and_si256(digits, _mm256_sub_epi8(block, _mm256_set1_epi8('0'))), _mm256_and_si256(letters, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+			const __m256i bytes = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(values, _mm256_set1_epi16(0x0F)), 4), _mm256_srli_epi16(values, 8));
+
+			if (dest != nullptr)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0x08)));
+
+			dest = (dest != nullptr) ? dest + 16 : nullptr;
+		}
+#endif
+#if defined(STR_SSE2)
+		for (; n_bytes >= 8; chars += 16, n_bytes -= 8)
+		{
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars)), lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+
+			const auto in_range = [](const __m128i block_, const char first, const char last)
+			{
+				const __m128i distance = _mm_sub_epi8(block_, _mm_set1_epi8(first));
+
+				return _mm_cmpeq_epi8(_mm_min_epu8(distance, _mm_set1_epi8(static_cast<char>(last - first))), distance);
+			};
+
+			const __m128i digits = in_range(block, '0', '9'), letters = in_range(lower, 'a', 'f');
+
+			if (_mm_movemask_epi8(_mm_or_si128(digits, letters)) != 0xFFFF)
+				return false;
+
+			const __m128i values = _mm_or_si128(_mm_and_si128(digits, _mm_sub_epi8(block, _mm_set1_epi8('0'))), _mm_and_si128(letters, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+			const __m128i bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x0F)), 4), _mm_srli_epi16(values, 8));
+
+			if (dest != nullptr)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dest), _mm_packus_epi16(bytes, bytes));
+
+			dest = (dest != nullptr) ? dest + 8 : nullptr;
+		}
+#endif
+
+		for (; n_bytes != 0; chars += 2, --n_bytes)
+		{
+			const int high = hex_value(chars[0]), low = hex_value(chars[1]);
+
+			if (high < 0 || low < 0)
+				return false;
+
+			if (dest != nullptr)
+				*dest++ = static_cast<unsigned char>(high * 16 + low);
+		}
+
+		return true;
+	}
+
+public:
+	// returns given bytes (as an STL string or string view) encoded in base64 with a given alphabet (the standard one by default). See (write_base64) for the vector kernel.
+	static std::string to_base64(const std::string_view data, const base64_alphabet alphabet = base64_standard)
+	{
+		std::string encoded(base64_size(data.length(), alphabet), '\0');
+		write_base64(reinterpret_cast<const unsigned char*>(data.data()), data.length(), encoded.data(), alphabet);
+
+		return encoded;
+	}
+	// returns this extended string encoded in base64 with a given alphabet (the standard one by default).
+	str to_base64(const base64_alphabet alphabet = base64_standard) const
+	{
+		return to_base64(_str, alphabet);
+	}
+	// writes a given number of bytes encoded in base64 with a given alphabet to a given destination if it has room for the encoded characters (a null destination having none), and returns the number of encoded characters.
+	static size_t to_base64(const void* const data, const size_t len, char* const dest, const size_t dest_size, const base64_alphabet alphabet = base64_standard) noexcept
+	{
+		const size_t size = base64_size(len, alphabet);
+
+		if (dest != nullptr && size <= dest_size)
+			write_base64(static_cast<const unsigned char*>(data), len, dest, alphabet);
+
+		return size;
+	}
+
+	// decodes given base64 characters with a given alphabet (the standard one by default) into a given STL string (replacing its content), and returns whether the characters are valid base64 (otherwise, the string is left empty). Decoding is strict: characters outside the alphabet (including whitespaces), misplaced or (with the standard alphabet) missing padding, and set bits that encode no byte are all invalid.
+	static bool from_base64(const std::string_view text, std::string& data, const base64_alphabet alphabet = base64_standard)
+	{
+		data.clear();
+
+		const size_t len = unpadded_base64_length(text.data(), text.length(), alphabet);
+
+		if (len == std::string::npos || len % 4 == 1)
+			return false;
+
+		data.resize(len / 4 * 3 + ((len % 4 == 0) ? 0 : len % 4 - 1));
+
+		if (read_base64(text.data(), len, reinterpret_cast<unsigned char*>(data.data()), alphabet) == std::string::npos)
+		{
+			data.clear();
+
+			return false;
+		}
+
+		return true;
+	}
+	// decodes this extended string as base64 characters with a given alphabet into a given STL string (replacing its content), and returns whether it is valid base64.
+	bool from_base64(std::string& data, const base64_alphabet alphabet = base64_standard) const
+	{
+		return from_base64(_str, data, alphabet);
+	}
+	// decodes a given character array of a given length as base64 characters with a given alphabet, writing the bytes to a given destination if it has room for them (a null destination having none), and returns the number of decoded bytes, or (npos) if the characters are not valid base64.
+	static size_t from_base64(const char* const chars, const size_t len, void* const dest, const size_t dest_size, const base64_alphabet alphabet = base64_standard) noexcept
+	{
+		const size_t len_ = unpadded_base64_length(chars, len, alphabet);
+
+		if (len_ == std::string::npos || len_ % 4 == 1)
+			return std::string::npos;
+
+		const size_t size = len_ / 4 * 3 + ((len_ % 4 == 0) ? 0 : len_ % 4 - 1);
+
+		return read_base64(chars, len_, (dest != nullptr && size <= dest_size) ? static_cast<unsigned char*>(dest) : nullptr, alphabet);
+	}
+
+	// returns given bytes (as an STL string or string view) encoded in hexadecimal, with lowercase digits. See (write_hex) for the vector kernel.
+	static std::string to_hex(const std::string_view data)
+	{
+		std::string encoded(data.length() * 2, '\0');
+		write_hex(reinterpret_cast<const unsigned char*>(data.data()), data.length(), encoded.data());
+
+		return encoded;
+	}
+	// returns this extended string encoded in hexadecimal, with lowercase digits.
+	str to_hex() const
+	{
+		return to_hex(_str);
+	}
+	// writes a given number of bytes encoded in hexadecimal to a given destination if it has room for the encoded characters (a null destination having none), and returns the number of encoded characters.
+	static size_t to_hex(const void* const data, const size_t len, char* const dest, const size_t dest_size) noexcept
+	{
+		if (dest != nullptr && len * 2 <= dest_size)
+			write_hex(static_cast<const unsigned char*>(data), len, dest);
+
+		return len * 2;
+	}
+
+	// decodes given hexadecimal characters (with lowercase or uppercase digits) into a given STL string (replacing its content), and returns whether the characters are valid hexadecimal: an even number of digits, without prefix or separators (otherwise, the string is left empty).
+	static bool from_hex(const std::string_view text, std::string& data)
+	{
+		data.clear();
+
+		if (text.length() % 2 != 0)
+			return false;
+
+		data.resize(text.length() / 2);
+
+		if (!read_hex(text.data(), data.length(), reinterpret_cast<unsigned char*>(data.data())))
+		{
+			data.clear();
+
+			return false;
+		}
+
+		return true;
+	}
+	// decodes this extended string as hexadecimal characters into a given STL string (replacing its content), and returns whether it is valid hexadecimal.
+	bool from_hex(std::string& data) const
+	{
+		return from_hex(_str, data);
+	}
+	// decodes a given character array of a given length as hexadecimal characters, writing the bytes to a given destination if it has room for them (a null destination having none), and returns the number of decoded bytes, or (npos) if the characters are not valid hexadecimal.
+	static size_t from_hex(const char* const chars, const size_t len, void* const dest, const size_t dest_size) noexcept
+	{
+		if (len % 2 != 0)
+			return std::string::npos;
+
+		const size_t size = len / 2;
+
+		return read_hex(chars, size, (dest != nullptr && size <= dest_size) ? static_cast<unsigned char*>(dest) : nullptr) ? size : std::string::npos;
+	}
+	
+	// extracts a character sequence from a given input stream and stores it into a given extended string (replacing its content). Note that extraction stops at the first whitespace character or at the end-of-file (EOF), whichever comes first. The operator returns the input stream from which characters were extracted.			
+	friend std::istream& operator>>(std::istream&, str&);
+	// inserts a copy of the character sequence that is the content of a given extended string into a given output stream. The operator returns the output stream to which characters were inserted.
+	friend std::ostream& operator<<(std::ostream&, const str&);
+	
+	// outputs an STL string followed by a newline to an output stream (the console by default), which is returned. The stream is not flushed by default.
+	static std::ostream& print_line(const std::string& str_, const bool flush = false, std::ostream& output_stream = std::cout)
+	{
+		output_stream << str_ << '\n';
+
+		if (flush)
+			output_stream.flush();
+
+		return output_stream;
+	}
+	// outputs this extended string to an output stream (the console by default), which is returned. The stream is not flushed by default.
+	std::ostream& print_line(const bool flush = false, std::ostream& output_stream = std::cout) const
+	{
+		output_stream << _str << '\n';
+
+		if (flush)
+			output_stream.flush();
+
+		return output_stream;
+	}
+
+	// appends an STL string followed by a newline to a file. The file is opened and closed on every call, so a line writer should be preferred for writing many lines.
+	static void print_line(const std::string& str_, const std::string& file_path, const bool flush = false)
+	{
+		std::fstream file_stream(file_path, std::ios::out | std::ios::app);
+		
+		file_stream << str_ << '\n';
+
+		if (flush)
+			file_stream.flush();
+	}
+	// appends this extended string followed by a newline to a file. The file is opened and closed on every call, so a line writer should be preferred for writing many lines.
+	void print_line(const std::string& file_path, const bool flush = false) const
+	{
+		print_line(_str, file_path, flush);
+	}
+
+	// outputs an STL string followed by a newline to a line writer, which is flushed if requested, and otherwise as its flush policy dictates.
+	static void print_line(const std::string& str_, line_writer& writer, const bool flush = false)
+	{
+		writer.write_line(str_);
+
+		if (flush)
+			writer.flush();
+	}
+	// outputs this extended string followed by a newline to a line writer, which is flushed if requested, and otherwise as its flush policy dictates.
+	void print_line(line_writer& writer, const bool flush = false) const
+	{
+		print_line(_str, writer, flush);
+	}
+
+	// outputs an STL string followed by a newline to an asynchronous sink, without making a system call, and returns whether it was buffered (rather than dropped).
+	static bool print_line(const std::string& str_, async_sink& sink)
+	{
+		return sink.write_line(str_);
+	}
+	// outputs this extended string followed by a newline to an asynchronous sink, without making a system call, and returns whether it was buffered (rather than dropped).
+	bool print_line(async_sink& sink) const
+	{
+		return sink.write_line(_str);
+	}
 };
 
-inline std::string operator*(const std::string& str_, const size_t n)
-{
-	return str::repeat(str_, n);
+inline std::string operator*(const std::string& str_, const size_t n)
+{
+	return str::repeat(str_, n);
+}
+inline std::string& operator*=(std::string& str_, const size_t n)
+{
+	str_ = str::repeat(str_, n);
+
+	return str_;
+}
+
+inline str operator*(const str& str_, const size_t n)
+{
+	return str_.repeat(n);
+}
+inline str& operator*=(str& str_, const size_t n)
+{
+	str_ = str_.repeat(n);
+
+	return str_;
+}
+
+inline bool operator==(const str& str_l, const str& str_r) noexcept
+{
+	return (str_l._str == str_r._str);
+}
+inline bool operator==(const str& str_l, const std::string& stl_str_r)
+{
+	return (str_l._str == stl_str_r);
+}
+inline bool operator==(const str& str_l, const char* char_arr_r)
+{
+	return (str_l.c_str() == char_arr_r);
+}
+inline bool operator==(const std::string& stl_str_l, const str& str_r)
+{
+	return (stl_str_l == str_r._str);
+}
+inline bool operator==(const char* char_arr_l, const str& str_r)
+{
+	return (char_arr_l == str_r.c_str());
+}
+
+inline bool operator!=(const str& str_l, const str& str_r) noexcept
+{
+	return (str_l._str != str_r._str);
+}
+inline bool operator!=(const str& str_l, const std::string& stl_str_r)
+{
+	return (str_l._str != stl_str_r);
+}
+inline bool operator!=(const str& str_l, const char* char_arr_r)
+{
+	return (str_l.c_str() != char_arr_r);
+}
+inline bool operator!=(const std::string& stl_str_l, const str& str_r)
+{
+	return (stl_str_l != str_r._str);
+}
+inline bool operator!=(const char* char_arr_l, const str& str_r)
+{
+	return (char_arr_l != str_r.c_str());
+}
+
+inline bool operator<(const str& str_l, const str& str_r) noexcept
+{
+	return (str_l._str < str_r._str);
+}
+inline bool operator<(const str& str_l, const std::string& stl_str_r)
+{
+	return (str_l._str < stl_str_r);
+}
+inline bool operator<(const str& str_l, const char* char_arr_r)
+{
+	return (str_l.c_str() < char_arr_r);
+}
+inline bool operator<(const std::string& stl_str_l, const str& str_r)
+{
+	return (stl_str_l.compare(str_r._str) < 0);
+}
+inline bool operator<(const char* char_arr_l, const str& str_r)
+{
+	return (char_arr_l < str_r.c_str());
+}
+
+inline bool operator<=(const str& str_l, const str& str_r) noexcept
+{
+	return (str_l._str <= str_r._str);
+}
+inline bool operator<=(const str& str_l, const std::string& stl_str_r)
+{
+	return (str_l._str <= stl_str_r);
+}
+inline bool operator<=(const str& str_l, const char* char_arr_r)
+{
+	return (str_l.c_str() <= char_arr_r);
+}
+inline bool operator<=(const std::string& stl_str_l, const str& str_r)
+{
+	return (stl_str_l.compare(str_r._str) <= 0);
+}
+inline bool operator<=(const char* char_arr_l, const str& str_r)
+{
+	return (char_arr_l <= str_r.c_str());
+}
+
+inline bool operator>(const str& str_l, const str& str_r) noexcept
+{
+	return (str_l._str > str_r._str);
+}
+inline bool operator>(const str& str_l, const std::string& stl_str_r)
+{
+	return (str_l._str > stl_str_r);
+}
+inline bool operator>(const str& str_l, const char* char_arr_r)
+{
+	return (str_l.c_str() > char_arr_r);
+}
+inline bool operator>(const std::string& stl_str_l, const str& str_r)
+{
+	return (stl_str_l.compare(str_r._str) > 0);
+}
+inline bool operator>(const char* char_arr_l, const str& str_r)
+{
+	return (char_arr_l > str_r.c_str());
+}
+
+inline bool operator>=(const str& str_l, const str& str_r) noexcept
+{
+	return (str_l._str >= str_r._str);
+}
+inline bool operator>=(const str& str_l, const std::string& stl_str_r)
+{
+	return (str_l._str >= stl_str_r);
+}
+inline bool operator>=(const str& str_l, const char* char_arr_r)
+{
+	return (str_l.c_str() >= char_arr_r);
+}
+inline bool operator>=(const std::string& stl_str_l, const str& str_r)
+{
+	return (stl_str_l.compare(str_r._str) >= 0);
+}
+inline bool operator>=(const char* char_arr_l, const str& str_r)
+{
+	return (char_arr_l >= str_r.c_str());
+}
+
+inline str operator+(const str& str_l, const str& str_r)
+{
+	return (str_l._str + str_r._str);
+}
+inline str operator+(const str& str_, const std::string& std_str)
+{
+	return (str_._str + std_str);
+}
+inline str operator+(const std::string& std_str, const str& str_)
+{
+	return (std_str + str_._str);
+}
+inline str operator+(const str& str_, const char* char_array)
+{
+	return (str_._str + char_array);
+}
+inline str operator+(const char* char_array, const str& str_)
+{
+	return (char_array + str_._str);
+}
+inline str operator+(const str& str_, char c)
+{
+	return (str_._str + c);
+}
+inline str operator+(char c, const str& str_)
+{
+	return (c + str_._str);
+}
+
+inline std::istream& operator>>(std::istream& input_stream, str& str_)
+{
+	return std::operator>>(input_stream, str_._str);
+}
+inline std::ostream& operator<<(std::ostream& output_stream, const str& str_)
+{
+	return std::operator<<(output_stream, str_._str);
+}
+
+/*
+Fused transformation pipelines over extended strings, STL strings and string views, such as text | str_pipes::trim | str_pipes::lower | str_pipes::split(',') | str_pipes::to_pieces.
+
+a pipeline is built lazily by piping a text into stages, and it runs when it is piped into a terminal, in a single pass over the text: every character is pushed through all the stages before the next one is read. The character stages (lower, upper, replace, keep_if, remove_if and map) map or drop characters, and the boundary stages (trim, capitalize and split) keep a little state across the characters; (split) ends a piece at each delimiter, and the stages after it apply to each piece separately (so split(',') | trim trims every field). Empty pieces are left out, as (str::split) does.
+
+a pipeline makes exactly one output buffer: the characters of (to_string) and (to_str), with the pieces joined by the delimiter they were split at, or the characters and the bounds of the pieces of (to_pieces). A pipeline whose stages change no character (trim and split only) can also end in (to_views), which returns views of the text itself without copying any character. A pipeline refers to its text, which must outlive it (a pipeline of a temporary string must be run in the same expression).
+*/
+namespace str_pipes
+{
+	namespace detail
+	{
+		// The base of the stages of pipelines.
+		struct stage_tag {};
+
+		// returns whether a given character is one of the whitespaces.
+		constexpr bool is_space(const char c) noexcept
+		{
+			return c == ' ' || (c >= '\t' && c <= '\r');
+		}
+
+		// The base of the stages that map or drop characters one at a time, which pass the ends of pieces on unchanged.
+		struct char_stage : stage_tag
+		{
+			template<class Next> void end_piece(const char delim, Next next) const
+			{
+				next.end_piece(delim);
+			}
+		};
+
+		// The position of the output of a sink, to which the output can be rewound (dropping the characters, and the ends of pieces, written after it).
+		struct sink_mark
+		{
+			char* pos = nullptr;
+			const char* piece_begin = nullptr;
+			size_t piece_pos = 0, n_pieces = 0;
+			char delim = '\0';
+			bool delim_pending = false;
+		};
+
+		// The chain of the stages of a running pipeline: each stage passes the characters (and the ends of pieces) it outputs to the next one, and the last one to the sink, which writes them out.
+		template<size_t I, class States, class Sink> struct stage_chain
+		{
+			States& states;
+			Sink& sink;
+
+			// returns the current position of the output of the sink.
+			sink_mark mark() const noexcept
+			{
+				return sink.mark();
+			}
+			// rewinds the output of the sink to a given position.
+			void rewind(const sink_mark& mark_) noexcept
+			{
+				sink.rewind(mark_);
+			}
+
+			void put(const char c)
+			{
+				if constexpr (I == std::tuple_size_v<States>)
+					sink.put(c);
+				else
+					std::get<I>(states).put(c, stage_chain<I + 1, States, Sink>{ states, sink });
+			}
+			// ends the current piece, which was split from the next one at a given delimiter.
+			void end_piece(const char delim)
+			{
+				if constexpr (I == std::tuple_size_v<States>)
+					sink.end_piece(delim);
+				else
+					std::get<I>(states).end_piece(delim, stage_chain<I + 1, States, Sink>{ states, sink });
+			}
+		};
+
+		// returns the state of a stage while a pipeline runs (a copy of the stage, unless it needs more state than it is constructed with).
+		template<class Stage> Stage state_of(const Stage& stage)
+		{
+			return stage;
+		}
+
+		template<class Text> using if_text = std::enable_if_t<std::is_same_v<Text, str> || std::is_convertible_v<const Text&, std::string_view>, int>;
+
+		// returns a view of the characters of an extended string, an STL string, a string view or a character array.
+		template<class Text> std::string_view view_of(const Text& text) noexcept
+		{
+			if constexpr (std::is_same_v<Text, str>)
+				return std::string_view(text.c_str(), text.length());
+			else
+				return std::string_view(text);
+		}
+	}
+
+	// The stage that maps the ASCII letters to lowercase.
+	struct lower_stage : detail::char_stage
+	{
+		template<class Next> void put(const char c, Next next) const
+		{
+			next.put((c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c);
+		}
+	};
+	// The stage that maps the ASCII letters to uppercase.
+	struct upper_stage : detail::char_stage
+	{
+		template<class Next> void put(const char c, Next next) const
+		{
+			next.put((c >= 'a' && c <= 'z') ? static_cast<char>(c & ~0x20) : c);
+		}
+	};
+	// The stage that replaces a character with another.
+	struct replace_stage : detail::char_stage
+	{
+		char from = '\0', to = '\0';
+
+		template<class Next> void put(const char c, Next next) const
+		{
+			next.put((c == from) ? to : c);
+		}
+	};
+	// The stage that keeps the characters of a class (if (keep) is true) or drops them (otherwise).
+	struct filter_stage : detail::char_stage
+	{
+		str::char_class class_ = {};
+		bool keep = true;
+
+		template<class Next> void put(const char c, Next next) const
+		{
+			if (class_.contains(c) == keep)
+				next.put(c);
+		}
+	};
+	// The stage that maps each character with a given function.
+	template<class Func> struct map_stage : detail::char_stage
+	{
+		Func func;
+
+		template<class Next> void put(const char c, Next next) const
+		{
+			next.put(static_cast<char>(func(c)));
+		}
+	};
+
+	// The stage that trims the leading and trailing whitespaces of each piece.
+	struct trim_stage : detail::stage_tag
+	{
+		// passes the view of a given piece without its leading and trailing whitespaces on (when a pipeline ends in views).
+		template<class Emit> void emit_views(const std::string_view piece, Emit&& emit) const
+		{
+			emit(str::trim_view(piece));
+		}
+	};
+	// The stage that maps the first ASCII letter of each whitespace-delimited word to uppercase.
+	struct capitalize_stage : detail::char_stage {};
+	// The stage that splits the text (or each piece) into pieces at a given delimiter.
+	struct split_stage : detail::stage_tag
+	{
+		char delim = ' ';
+
+		template<class Next> void put(const char c, Next next) const
+		{
+			if (c == delim)
+				next.end_piece(delim);
+			else
+				next.put(c);
+		}
+		template<class Next> void end_piece(const char delim_, Next next) const
+		{
+			next.end_piece(delim_);
+		}
+		// passes the views of the pieces of a given piece on (when a pipeline ends in views).
+		template<class Emit> void emit_views(const std::string_view piece, Emit&& emit) const
+		{
+			size_t start_pos = 0, delim_pos = 0;
+
+			while ((delim_pos = piece.find(delim, start_pos)) != std::string_view::npos)
+			{
+				emit(piece.substr(start_pos, delim_pos - start_pos));
+				start_pos = delim_pos + 1;
+			}
+
+			emit(piece.substr(start_pos));
+		}
+	};
+
+	namespace detail
+	{
+		// The state of a trimming stage: the leading whitespaces of the current piece are dropped, and the others are passed on as they come, with the position of the output before the first of those that no other character has followed yet marked, so that the output is rewound to it (dropping the trailing whitespaces) at the end of the piece. Nothing is buffered, however long a run of whitespaces is.
+		struct trim_state
+		{
+			sink_mark mark = {};
+			bool started = false, trailing = false;
+
+			template<class Next> void put(const char c, Next next)
+			{
+				if (is_space(c))
+				{
+					if (!started)
+						return;
+
+					if (!trailing)
+					{
+						mark = next.mark();
+						trailing = true;
+					}
+				}
+				else
+				{
+					started = true;
+					trailing = false;
+				}
+
+				next.put(c);
+			}
+			template<class Next> void end_piece(const char delim, Next next)
+			{
+				if (trailing)
+					next.rewind(mark);
+
+				started = false;
+				trailing = false;
+				next.end_piece(delim);
+			}
+		};
+		inline trim_state state_of(const trim_stage&)
+		{
+			return {};
+		}
+
+		// The state of a capitalizing stage: whether the next character starts a word.
+		struct capitalize_state
+		{
+			bool at_initial = true;
+
+			template<class Next> void put(const char c, Next next)
+			{
+				next.put((at_initial && c >= 'a' && c <= 'z') ? static_cast<char>(c & ~0x20) : c);
+				at_initial = is_space(c);
+			}
+			template<class Next> void end_piece(const char delim, Next next)
+			{
+				at_initial = true;
+				next.end_piece(delim);
+			}
+		};
+		inline capitalize_state state_of(const capitalize_stage&)
+		{
+			return {};
+		}
+
+		// The sink of a pipeline that ends in a single string: it writes the characters to a buffer as long as the text (which no stage can lengthen), with the non-empty pieces joined by the delimiters they were split at.
+		struct string_sink
+		{
+			char* pos = nullptr;
+			const char* piece_begin = nullptr;
+			char delim = '\0';
+			bool delim_pending = false;
+
+			void put(const char c)
+			{
+				if (delim_pending)
+				{
+					*pos++ = delim;
+					piece_begin = pos;
+					delim_pending = false;
+				}
+
+				*pos++ = c;
+			}
+			void end_piece(const char delim_)
+			{
+				if (pos != piece_begin)
+				{
+					delim = delim_;
+					delim_pending = true;
+				}
+			}
+
+			sink_mark mark() const noexcept
+			{
+				sink_mark mark_ = {};
+				mark_.pos = pos;
+				mark_.piece_begin = piece_begin;
+				mark_.delim = delim;
+				mark_.delim_pending = delim_pending;
+
+				return mark_;
+			}
+			void rewind(const sink_mark& mark_) noexcept
+			{
+				pos = mark_.pos;
+				piece_begin = mark_.piece_begin;
+				delim = mark_.delim;
+				delim_pending = mark_.delim_pending;
+			}
+		};
+
+		// The sink of a pipeline that ends in pieces: it writes the characters of the non-empty pieces to a buffer as long as the text, one after another, and records where each piece ends.
+		struct pieces_sink
+		{
+			char* const begin = nullptr;
+			char* pos = nullptr;
+			size_t piece_pos = 0;
+			std::vector<std::pair<size_t, size_t>>& bounds;
+
+			void put(const char c)
+			{
+				*pos++ = c;
+			}
+			void end_piece(const char)
+			{
+				const size_t end_pos = static_cast<size_t>(pos - begin);
+
+				if (end_pos != piece_pos)
+					bounds.emplace_back(piece_pos, end_pos);
+
+				piece_pos = end_pos;
+			}
+
+			sink_mark mark() const noexcept
+			{
+				sink_mark mark_ = {};
+				mark_.pos = pos;
+				mark_.piece_pos = piece_pos;
+				mark_.n_pieces = bounds.size();
+
+				return mark_;
+			}
+			// (the bounds of the pieces ended after the mark are dropped, which does not reallocate them.)
+			void rewind(const sink_mark& mark_) noexcept
+			{
+				pos = mark_.pos;
+				piece_pos = mark_.piece_pos;
+				bounds.resize(mark_.n_pieces);
+			}
+		};
+	}
+
+	// The pieces output by a pipeline: their characters, in a single buffer, and the bounds of each piece in it.
+	class pieces
+	{
+		std::string chars = {};
+		std::vector<std::pair<size_t, size_t>> bounds = {};
+
+		template<class... Stages> friend class pipeline;
+
+	public:
+		// A forward iterator over views of the pieces.
+		class iterator
+		{
+			const pieces* pieces_ = nullptr;
+			size_t i = 0;
+
+			friend class pieces;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = std::string_view;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const std::string_view*;
+			using reference = std::string_view;
+
+			iterator() = default;
+
+			// returns a view of the current piece.
+			std::string_view operator*() const noexcept
+			{
+				return (*pieces_)[i];
+			}
+
+			// advances to the next piece.
+			iterator& operator++() noexcept
+			{
+				++i;
+
+				return *this;
+			}
+			iterator operator++(int) noexcept
+			{
+				iterator it = *this;
+				++i;
+
+				return it;
+			}
+
+			// returns whether this iterator and another are at the same piece.
+			bool operator==(const iterator& other) const noexcept
+			{
+				return i == other.i;
+			}
+			bool operator!=(const iterator& other) const noexcept
+			{
+				return i != other.i;
+			}
+		};
+
+		// returns the number of pieces.
+		size_t size() const noexcept
+		{
+			return bounds.size();
+		}
+		// returns whether there is no piece.
+		bool empty() const noexcept
+		{
+			return bounds.empty();
+		}
+		// returns a view of the piece at a given index, valid as long as these pieces are.
+		std::string_view operator[](const size_t i) const noexcept
+		{
+			return std::string_view(chars).substr(bounds[i].first, bounds[i].second - bounds[i].first);
+		}
+
+		// returns iterators to the first piece and past the last one.
+		iterator begin() const noexcept
+		{
+			iterator it = {};
+			it.pieces_ = this;
+
+			return it;
+		}
+		iterator end() const noexcept
+		{
+			iterator it = {};
+			it.pieces_ = this;
+			it.i = size();
+
+			return it;
+		}
+	};
+
+	// A lazy pipeline of stages over a text, run by piping it into a terminal (to_string, to_str, to_pieces or to_views).
+	template<class... Stages> class pipeline
+	{
+		std::string_view text = {};
+		std::tuple<Stages...> stages = {};
+
+		// pushes the characters of the text through (the states of) the stages into a given sink.
+		template<class Sink> void run(Sink& sink) const
+		{
+			auto states = std::apply([](const Stages&... stages_) { return std::make_tuple(detail::state_of(stages_)...); }, stages);
+			detail::stage_chain<0, decltype(states), Sink> chain = { states, sink };
+
+			for (const char c : text)
+				chain.put(c);
+
+			// the end of the text ends the last piece.
+			chain.end_piece('\0');
+		}
+		// passes the views of the pieces of a given piece output by the stages from a given one on to a given function.
+		template<size_t I, class Emit> void emit_views(const std::string_view piece, Emit& emit) const
+		{
+			if constexpr (I == sizeof...(Stages))
+			{
+				if (!piece.empty())
+					emit(piece);
+			}
+			else
+				std::get<I>(stages).emit_views(piece, [&](const std::string_view piece_) { emit_views<I + 1>(piece_, emit); });
+		}
+
+	public:
+		pipeline(const std::string_view text_, std::tuple<Stages...> stages_) : text(text_), stages(std::move(stages_)) {}
+
+		// returns this pipeline with a given stage appended.
+		template<class Stage> pipeline<Stages..., Stage> then(const Stage& stage) const
+		{
+			return { text, std::tuple_cat(stages, std::make_tuple(stage)) };
+		}
+
+		// runs this pipeline, and returns its output as an STL string (with the pieces, if split, joined by their delimiters).
+		std::string to_string() const
+		{
+			std::string output(text.length(), '\0');
+			detail::string_sink sink = { output.data(), output.data() };
+
+			run(sink);
+			output.resize(static_cast<size_t>(sink.pos - output.data()));
+
+			return output;
+		}
+		// runs this pipeline, and returns its output as an extended string.
+		str to_str() const
+		{
+			return str(to_string());
+		}
+		// runs this pipeline, and returns the pieces it outputs.
+		pieces to_pieces() const
+		{
+			pieces pieces_ = {};
+			pieces_.chars.resize(text.length());
+
+			detail::pieces_sink sink = { pieces_.chars.data(), pieces_.chars.data(), 0, pieces_.bounds };
+
+			run(sink);
+			pieces_.chars.resize(static_cast<size_t>(sink.pos - pieces_.chars.data()));
+
+			return pieces_;
+		}
+		// returns views of the pieces of the text output by this pipeline, without copying any character. Only the stages that do not change characters (trim and split) are allowed.
+		std::vector<std::string_view> to_views() const
+		{
+			static_assert(((std::is_same_v<Stages, trim_stage> || std::is_same_v<Stages, split_stage>) && ...), "only trim and split can end in views");
+
+			std::vector<std::string_view> views = {};
+			const auto emit = [&](const std::string_view piece) { views.push_back(piece); };
+
+			emit_views<0>(text, emit);
+
+			return views;
+		}
+	};
+
+	// The terminals of pipelines.
+	struct to_string_t {};
+	struct to_str_t {};
+	struct to_pieces_t {};
+	struct to_views_t {};
+
+	inline constexpr to_string_t to_string = {};
+	inline constexpr to_str_t to_str = {};
+	inline constexpr to_pieces_t to_pieces = {};
+	inline constexpr to_views_t to_views = {};
+
+	// The stages of pipelines.
+	inline constexpr lower_stage lower = {};
+	inline constexpr upper_stage upper = {};
+	inline constexpr trim_stage trim = {};
+	inline constexpr capitalize_stage capitalize = {};
+
+	// returns the stage that replaces a given character with another.
+	constexpr replace_stage replace(const char from, const char to) noexcept
+	{
+		replace_stage stage = {};
+		stage.from = from;
+		stage.to = to;
+
+		return stage;
+	}
+	// returns the stage that keeps only the characters of a given class.
+	constexpr filter_stage keep_if(const str::char_class& class_) noexcept
+	{
+		filter_stage stage = {};
+		stage.class_ = class_;
+		stage.keep = true;
+
+		return stage;
+	}
+	// returns the stage that drops the characters of a given class.
+	constexpr filter_stage remove_if(const str::char_class& class_) noexcept
+	{
+		filter_stage stage = {};
+		stage.class_ = class_;
+		stage.keep = false;
+
+		return stage;
+	}
+	// returns the stage that maps each character with a given function (from a character to a character).
+	template<class Func> map_stage<Func> map(Func func)
+	{
+		return { {}, std::move(func) };
+	}
+	// returns the stage that splits the text (or each piece) at a given delimiter (a space by default).
+	constexpr split_stage split(const char delim = ' ') noexcept
+	{
+		split_stage stage = {};
+		stage.delim = delim;
+
+		return stage;
+	}
+
+	// returns a pipeline of a given stage over a given extended string, STL string, string view or character array.
+	template<class Text, class Stage, detail::if_text<Text> = 0, std::enable_if_t<std::is_base_of_v<detail::stage_tag, Stage>, int> = 0> pipeline<Stage> operator|(const Text& text, const Stage& stage)
+	{
+		return { detail::view_of(text), std::make_tuple(stage) };
+	}
+	// returns a given pipeline with a given stage appended.
+	template<class... Stages, class Stage, std::enable_if_t<std::is_base_of_v<detail::stage_tag, Stage>, int> = 0> pipeline<Stages..., Stage> operator|(const pipeline<Stages...>& pipeline_, const Stage& stage)
+	{
+		return pipeline_.then(stage);
+	}
+
+	// runs a given pipeline into a terminal.
+	template<class... Stages> std::string operator|(const pipeline<Stages...>& pipeline_, to_string_t)
+	{
+		return pipeline_.to_string();
+	}
+	template<class... Stages> str operator|(const pipeline<Stages...>& pipeline_, to_str_t)
+	{
+		return pipeline_.to_str();
+	}
+	template<class... Stages> pieces operator|(const pipeline<Stages...>& pipeline_, to_pieces_t)
+	{
+		return pipeline_.to_pieces();
+	}
+	template<class... Stages> std::vector<std::string_view> operator|(const pipeline<Stages...>& pipeline_, to_views_t)
+	{
+		return pipeline_.to_views();
+	}
 }
-inline std::string& operator*=(std::string& str_, const size_t n)
-{
-	str_ = str::repeat(str_, n);
 
-	return str_;
-}
 
-inline str operator*(const str& str_, const size_t n)
-{
-	return str_.repeat(n);
-}
-inline str& operator*=(str& str_, const size_t n)
-{
-	str_ = str_.repeat(n);
+// Fixed strings, which require C++20 (for class types as non-type template parameters).
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
 
-	return str_;
-}
+/*
+A string of a fixed number of characters (not counting the null terminator that follows them), whose operations are all constexpr, meant for constant keys and messages built from literals at compile time without any allocation.
 
-inline bool operator==(const str& str_l, const str& str_r) noexcept
-{
-	return (str_l._str == str_r._str);
-}
-inline bool operator==(const str& str_l, const std::string& stl_str_r)
-{
-	return (str_l._str == stl_str_r);
-}
-inline bool operator==(const str& str_l, const char* char_arr_r)
-{
-	return (str_l.c_str() == char_arr_r);
-}
-inline bool operator==(const std::string& stl_str_l, const str& str_r)
-{
-	return (stl_str_l == str_r._str);
-}
-inline bool operator==(const char* char_arr_l, const str& str_r)
+a fixed string is deduced from a string literal (as in fixed_str("key")), can be used as a non-type template parameter (as in template<fixed_str Key>), and converts to a string view (for free) or to an extended string (by copying its characters once).
+*/
+template<size_t N> struct fixed_str
 {
-	return (char_arr_l == str_r.c_str());
-}
+	// The characters of this fixed string, followed by a null character. (public, as required for fixed strings to be usable as template arguments.)
+	char chars[N + 1] = { };
 
-inline bool operator!=(const str& str_l, const str& str_r) noexcept
-{
-	return (str_l._str != str_r._str);
-}
-inline bool operator!=(const str& str_l, const std::string& stl_str_r)
-{
-	return (str_l._str != stl_str_r);
-}
-inline bool operator!=(const str& str_l, const char* char_arr_r)
-{
-	return (str_l.c_str() != char_arr_r);
-}
-inline bool operator!=(const std::string& stl_str_l, const str& str_r)
-{
-	return (stl_str_l != str_r._str);
-}
-inline bool operator!=(const char* char_arr_l, const str& str_r)
-{
-	return (char_arr_l != str_r.c_str());
-}
+	// constructs a fixed string of null characters.
+	constexpr fixed_str() noexcept = default;
+	// constructs a fixed string from a string literal (or a character array whose last element is the null terminator).
+	constexpr fixed_str(const char (&char_arr)[N + 1]) noexcept
+	{
+		for (size_t i = 0; i < N; ++i)
+			chars[i] = char_arr[i];
+	}
 
-inline bool operator<(const str& str_l, const str& str_r) noexcept
-{
-	return (str_l._str < str_r._str);
-}
-inline bool operator<(const str& str_l, const std::string& stl_str_r)
-{
-	return (str_l._str < stl_str_r);
-}
-inline bool operator<(const str& str_l, const char* char_arr_r)
-{
-	return (str_l.c_str() < char_arr_r);
-}
-inline bool operator<(const std::string& stl_str_l, const str& str_r)
-{
-	return (stl_str_l < str_r._str);
-}
-inline bool operator<(const char* char_arr_l, const str& str_r)
-{
-	return (char_arr_l < str_r.c_str());
-}
+	// returns the number of characters of a fixed string.
+	static constexpr size_t length() noexcept
+	{
+		return N;
+	}
+	// returns the number of characters of a fixed string.
+	static constexpr size_t size() noexcept
+	{
+		return N;
+	}
+	// returns whether a fixed string has no characters.
+	static constexpr bool empty() noexcept
+	{
+		return N == 0;
+	}
 
-inline bool operator<=(const str& str_l, const str& str_r) noexcept
-{
-	return (str_l._str <= str_r._str);
-}
-inline bool operator<=(const str& str_l, const std::string& stl_str_r)
-{
-	return (str_l._str <= stl_str_r);
-}
-inline bool operator<=(const str& str_l, const char* char_arr_r)
-{
-	return (str_l.c_str() <= char_arr_r);
-}
-inline bool operator<=(const std::string& stl_str_l, const str& str_r)
-{
-	return (stl_str_l <= str_r._str);
-}
-inline bool operator<=(const char* char_arr_l, const str& str_r)
-{
-	return (char_arr_l <= str_r.c_str());
-}
+	// returns the character at a given offset from the first character of this fixed string.
+	constexpr char operator[](const size_t i) const noexcept
+	{
+		return chars[i];
+	}
+	// returns the null-terminated character array of this fixed string.
+	constexpr const char* c_str() const noexcept
+	{
+		return chars;
+	}
+	// returns the null-terminated character array of this fixed string.
+	constexpr const char* data() const noexcept
+	{
+		return chars;
+	}
+	// returns a pointer to the first character of this fixed string.
+	constexpr const char* begin() const noexcept
+	{
+		return chars;
+	}
+	// returns a pointer to the after-the-last character (the null terminator) of this fixed string.
+	constexpr const char* end() const noexcept
+	{
+		return chars + N;
+	}
 
-inline bool operator>(const str& str_l, const str& str_r) noexcept
-{
-	return (str_l._str > str_r._str);
-}
-inline bool operator>(const str& str_l, const std::string& stl_str_r)
-{
-	return (str_l._str > stl_str_r);
-}
-inline bool operator>(const str& str_l, const char* char_arr_r)
-{
-	return (str_l.c_str() > char_arr_r);
-}
-inline bool operator>(const std::string& stl_str_l, const str& str_r)
-{
-	return (stl_str_l > str_r._str);
-}
-inline bool operator>(const char* char_arr_l, const str& str_r)
-{
-	return (char_arr_l > str_r.c_str());
-}
+	// returns a view of the characters of this fixed string.
+	constexpr std::string_view view() const noexcept
+	{
+		return { chars, N };
+	}
+	// converts this fixed string to a view of its characters.
+	constexpr operator std::string_view() const noexcept
+	{
+		return view();
+	}
+	// converts this fixed string to an extended string, copying its characters once.
+	operator str() const
+	{
+		return str(std::string(chars, N));
+	}
 
-inline bool operator>=(const str& str_l, const str& str_r) noexcept
-{
-	return (str_l._str >= str_r._str);
-}
-inline bool operator>=(const str& str_l, const std::string& stl_str_r)
-{
-	return (str_l._str >= stl_str_r);
-}
-inline bool operator>=(const str& str_l, const char* char_arr_r)
-{
-	return (str_l.c_str() >= char_arr_r);
-}
-inline bool operator>=(const std::string& stl_str_l, const str& str_r)
-{
-	return (stl_str_l >= str_r._str);
-}
-inline bool operator>=(const char* char_arr_l, const str& str_r)
-{
-	return (char_arr_l >= str_r.c_str());
-}
+	// returns this fixed string with every lowercase letter converted to uppercase.
+	constexpr fixed_str to_upper() const noexcept
+	{
+		fixed_str upper = *this;
 
-inline str operator+(const str& str_l, const str& str_r)
-{
-	return (str_l._str + str_r._str);
-}
-inline str operator+(const str& str_, const std::string& std_str)
-{
-	return (str_._str + std_str);
-}
-inline str operator+(const std::string& std_str, const str& str_)
-{
-	return (std_str + str_._str);
-}
-inline str operator+(const str& str_, const char* char_array)
-{
-	return (str_._str + char_array);
-}
-inline str operator+(const char* char_array, const str& str_)
-{
-	return (char_array + str_._str);
-}
-inline str operator+(const str& str_, char c)
-{
-	return (str_._str + c);
-}
-inline str operator+(char c, const str& str_)
+		for (size_t i = 0; i < N; ++i)
+			if (upper.chars[i] >= 'a' && upper.chars[i] <= 'z')
+				upper.chars[i] = static_cast<char>(upper.chars[i] - 'a' + 'A');
+
+		return upper;
+	}
+	// returns this fixed string with every uppercase letter converted to lowercase.
+	constexpr fixed_str to_lower() const noexcept
+	{
+		fixed_str lower = *this;
+
+		for (size_t i = 0; i < N; ++i)
+			if (lower.chars[i] >= 'A' && lower.chars[i] <= 'Z')
+				lower.chars[i] = static_cast<char>(lower.chars[i] - 'A' + 'a');
+
+		return lower;
+	}
+
+	// returns this fixed string repeated a given number of times.
+	template<size_t n> constexpr fixed_str<N * n> repeat() const noexcept
+	{
+		fixed_str<N * n> repeated = {};
+
+		for (size_t i = 0; i < N * n; ++i)
+			repeated.chars[i] = chars[i % N];
+
+		return repeated;
+	}
+
+	// returns the concatenation of this fixed string and another.
+	template<size_t M> constexpr fixed_str<N + M> operator+(const fixed_str<M>& other) const noexcept
+	{
+		fixed_str<N + M> concatenated = {};
+
+		for (size_t i = 0; i < N; ++i)
+			concatenated.chars[i] = chars[i];
+		for (size_t i = 0; i < M; ++i)
+			concatenated.chars[N + i] = other.chars[i];
+
+		return concatenated;
+	}
+	// returns the concatenation of this fixed string and a string literal.
+	template<size_t M> constexpr fixed_str<N + M - 1> operator+(const char (&char_arr)[M]) const noexcept
+	{
+		return *this + fixed_str<M - 1>(char_arr);
+	}
+
+	// returns whether this fixed string and another have the same characters.
+	template<size_t M> constexpr bool operator==(const fixed_str<M>& other) const noexcept
+	{
+		return view() == other.view();
+	}
+};
+
+template<size_t N> fixed_str(const char (&)[N]) -> fixed_str<N - 1>;
+
+// returns a given fixed string without its leading and trailing whitespaces (the fixed string being a template argument, as the length of the result depends on its characters).
+template<fixed_str S> constexpr auto fixed_trim() noexcept
 {
-	return (c + str_._str);
+	const auto is_whitespace = [](const char c)
+	{
+		for (const char whitespace : whitespaces)
+			if (c == whitespace)
+				return true;
+
+		return false;
+	};
+
+	constexpr size_t first = [&]()
+	{
+		size_t i = 0;
+
+		while (i < S.length() && is_whitespace(S[i]))
+			++i;
+
+		return i;
+	}();
+	constexpr size_t last = [&]()
+	{
+		size_t i = S.length();
+
+		while (i > first && is_whitespace(S[i - 1]))
+			--i;
+
+		return i;
+	}();
+
+	fixed_str<last - first> trimmed = {};
+
+	for (size_t i = first; i < last; ++i)
+		trimmed.chars[i - first] = S[i];
+
+	return trimmed;
 }
 
-inline std::istream& operator>>(std::istream& input_stream, str& str_)
+// returns an array of views of the substrings separated by a given delimiter (a space by default) in a given fixed string, as (str::split) does (empty substrings are left out). The views refer to the template argument, so they are valid for the entire program.
+template<fixed_str S, char delim = ' '> constexpr auto fixed_split() noexcept
 {
-	return std::operator>>(input_stream, str_._str);
+	constexpr size_t n_substrs = []()
+	{
+		size_t n = 0;
+
+		for (size_t i = 0; i < S.length(); ++i)
+			n += (S[i] != delim) && (i == 0 || S[i - 1] == delim);
+
+		return n;
+	}();
+
+	std::array<std::string_view, n_substrs> substrs = { };
+	size_t n = 0;
+
+	for (size_t i = 0; i < S.length(); ++i)
+	{
+		if (S[i] == delim || (i != 0 && S[i - 1] != delim))
+			continue;
+
+		size_t end = i;
+
+		while (end < S.length() && S[end] != delim)
+			++end;
+
+		substrs[n++] = S.view().substr(i, end - i);
+	}
+
+	return substrs;
 }
-inline std::ostream& operator<<(std::ostream& output_stream, const str& str_)
+
+// joins given fixed strings into one, separating them using a given fixed delimiter.
+template<size_t D, size_t... Ns> constexpr auto fixed_join(const fixed_str<D>& delim, const fixed_str<Ns>&... strs) noexcept
 {
-	return std::operator<<(output_stream, str_._str);
+	constexpr size_t n_strs = sizeof...(Ns);
+
+	fixed_str<(Ns + ... + 0) + D * (n_strs == 0 ? 0 : n_strs - 1)> joined = {};
+
+	// (the array has an extra element so that it is not empty when no string is given.)
+	const std::string_view views[] = { strs.view()..., std::string_view() };
+	size_t pos = 0;
+
+	for (size_t i = 0; i < n_strs; ++i)
+	{
+		if (i != 0)
+			for (const char c : delim.view())
+				joined.chars[pos++] = c;
+
+		for (const char c : views[i])
+			joined.chars[pos++] = c;
+	}
+
+	return joined;
 }
+
+#endif